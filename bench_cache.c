@@ -0,0 +1,130 @@
+/* bench_cache.c
+ * The frame cache of synth_frame(): renders a sequence that keeps coming
+ * back to a few distinct frames three times, with no cache, with a big
+ * one (each frame in a few starting states) and with one that holds only
+ * three frames, so that most are evicted.  All three must give the same
+ * samples.  BPSK and DUV, each with the integer NCO on and off.
+ *
+ * gcc -O2 -o bench_cache bench_cache.c synth.c symbols.c decoder.c interleave.c rs.c wav.c checksum.c -lm
+ * ./bench_cache [frames] [distinct frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "make_wav.h"
+#include "symbols.h"
+#include "decoder.h"
+#include "synth.h"
+
+#define BPSK_SYMBOLS (476 + 3 * NP)
+#define DUV_SYMBOLS (64 + NP)
+#define SMALL_FRAMES 3		// frames the small cache holds
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Render the sequence with max_bytes of frame cache (0 for none)
+static double render(struct synth *s, int duv, int nco, long max_bytes, const int *seq,
+	long frames, const struct symbols *distinct, int symbols)
+{
+	long sync = duv ? SYNC_DUV : SYNC_BPSK;
+	int sync_bits = duv ? SYNC_DUV_BITS : SYNC_BPSK_BITS;
+	double t;
+
+	if (synth_init(s, 48000, WAV_S16, duv ? 200 : 1200, duv,
+			frames * (sync_bits + 10L * symbols)) != 0
+		|| synth_frame_cache(s, max_bytes) != 0)
+		return -1;
+	s->nco = nco;
+	t = now();
+	for (long f = 0; f < frames; f++)
+		synth_frame(s, sync, sync_bits, &distinct[seq[f]], symbols);
+	return now() - t;
+}
+
+static int run(int duv, int nco, long frames, int ndistinct)
+{
+	int symbols = duv ? DUV_SYMBOLS : BPSK_SYMBOLS;
+	struct symbols *distinct = malloc(ndistinct * sizeof(struct symbols));
+	int *seq = malloc(frames * sizeof(int));
+	unsigned char data[BPSK_SYMBOLS];
+	struct synth plain, big, small;
+	long frame_bytes;
+	double t[3];
+	int fail = 0;
+
+	if (distinct == NULL || seq == NULL)
+		return -1;
+	for (int k = 0; k < ndistinct; k++) {
+		int32_t rd = 0;
+		for (int i = 0; i < symbols; i++)
+			data[i] = rand();
+		if (symbols_init(&distinct[k], SYMBOLS_PACKED, symbols) != 0)
+			return -1;
+		symbols_encode(&distinct[k], 0, data, symbols, &rd);
+	}
+	for (long f = 0; f < frames; f++)
+		seq[f] = rand() % ndistinct;
+
+	// samples of one frame, and what the cache keeps besides
+	frame_bytes = ((duv ? SYNC_DUV_BITS : SYNC_BPSK_BITS) + 10L * symbols)
+		* (48000 / (duv ? 200 : 1200)) * sizeof(short int) + 1024;
+	t[0] = render(&plain, duv, nco, 0, seq, frames, distinct, symbols);
+	t[1] = render(&big, duv, nco, 4 * ndistinct * frame_bytes, seq, frames, distinct, symbols);
+	t[2] = render(&small, duv, nco, SMALL_FRAMES * frame_bytes, seq, frames, distinct, symbols);
+	if (t[0] < 0 || t[1] < 0 || t[2] < 0)
+		return -1;
+
+	printf("%-4s nco %d  %8.1f ms  %8.1f ms %5ld hits  %8.1f ms %5ld hits %5ld evictions\n",
+		duv ? "DUV" : "BPSK", nco, 1e3 * t[0], 1e3 * t[1], big.frame_hits,
+		1e3 * t[2], small.frame_hits, small.frame_evictions);
+	if (big.ctr != plain.ctr || memcmp(big.buffer, plain.buffer, plain.buf_len * sizeof(short int))
+		|| small.ctr != plain.ctr
+		|| memcmp(small.buffer, plain.buffer, plain.buf_len * sizeof(short int))) {
+		printf("FAIL: cached samples differ from uncached ones\n");
+		fail = 1;
+	} else if (big.frame_hits == 0 || small.frame_hits == 0 || small.frame_evictions == 0) {
+		printf("FAIL: the sequence did not exercise hits and evictions\n");
+		fail = 1;
+	}
+	synth_free(&plain);
+	synth_free(&big);
+	synth_free(&small);
+	for (int k = 0; k < ndistinct; k++)
+		symbols_free(&distinct[k]);
+	free(distinct);
+	free(seq);
+	return fail;
+}
+
+int main(int argc, char * argv[])
+{
+	long frames = argc > 1 ? atol(argv[1]) : 200;
+	int ndistinct = argc > 2 ? atoi(argv[2]) : 8;
+
+	if (frames < 1)
+		frames = 1;
+	if (ndistinct <= SMALL_FRAMES)
+		ndistinct = SMALL_FRAMES + 1;	// or nothing would be evicted
+	srand(1);
+	printf("%ld frames of %d distinct ones, rendered with no cache, a big cache"
+		" and one of %d frames\n", frames, ndistinct, SMALL_FRAMES);
+	printf("%-11s %11s %23s %39s\n", "", "no cache", "big cache", "small cache");
+	for (int duv = 0; duv < 2; duv++)
+		for (int nco = 0; nco < 2; nco++) {
+			int r = run(duv, nco, frames, ndistinct);
+			if (r < 0)
+				fprintf(stderr, "Out of memory\n");
+			if (r)
+				return 1;
+		}
+	return 0;
+}
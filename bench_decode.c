@@ -0,0 +1,177 @@
+/* bench_decode.c
+ * Decode yield and speed of the Fox-1 receive path on frames sent through
+ * a channel with random bit errors, with and without 8b10b erasures, and
+ * from a bit stream of frames in either polarity.
+ *
+ * gcc -O2 -o bench_decode bench_decode.c decoder.c interleave.c rs.c
+ * ./bench_decode [frames] [bit error rate]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "make_wav.h"
+#include "rs.h"
+#include "decoder.h"
+
+#define DATA_BYTES 476	// BPSK: 8 header + 6 * 78 payload bytes
+#define RS_FRAMES 3
+#define SYMBOLS (DATA_BYTES + RS_FRAMES * NP)
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Encode data[] into the 10-bit symbols of one frame, as make_wav does
+static void encode_frame(const unsigned char *data, short int *words)
+{
+	struct rs_encoder enc[RS_FRAMES];
+	unsigned char parity[RS_FRAMES][NP];
+	int32_t rd = 0;
+	int n = 0;
+
+	for (int j = 0; j < RS_FRAMES; j++)
+		rs_encoder_init(&enc[j]);
+	for (int k = 0; k < DATA_BYTES; k++)
+		rs_encoder_update(&enc[k % RS_FRAMES], data[k]);
+	for (int j = 0; j < RS_FRAMES; j++)
+		rs_encoder_parity(&enc[j], parity[j]);
+
+	for (int k = 0; k < DATA_BYTES; k++)
+		words[n++] = encode_8b10b(&rd, data[k]);
+	for (int i = 0; i < NP; i++)
+		for (int j = 0; j < RS_FRAMES; j++)
+			words[n++] = encode_8b10b(&rd, parity[j][i]);
+}
+
+int main(int argc, char * argv[])
+{
+	static const char *names[] = { "errors only", "erasures", "erasures+suspects" };
+	long frames = argc > 1 ? atol(argv[1]) : 2000;
+	double ber = argc > 2 ? atof(argv[2]) : 0.004;
+	static unsigned char data[DATA_BYTES], out[DATA_BYTES];
+	static short int sent[SYMBOLS], recv[SYMBOLS];
+	static unsigned char bytes[SYMBOLS], flags[SYMBOLS];
+	short int (*channel)[SYMBOLS];
+	long good[3] = { 0 }, erased = 0, suspect = 0, flagged = 0;
+	double t[3] = { 0 }, t0;
+
+	channel = malloc(frames * sizeof(*channel));
+	if (channel == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	srand(1);
+	decode_init();
+	for (long f = 0; f < frames; f++) {
+		for (int k = 0; k < DATA_BYTES; k++)
+			data[k] = rand();
+		encode_frame(data, sent);
+		for (int k = 0; k < SYMBOLS; k++) {
+			channel[f][k] = sent[k];
+			for (int b = 0; b < 10; b++)
+				if (rand() < ber * RAND_MAX)
+					channel[f][k] ^= 1 << b;
+		}
+		// decode each frame every way, timing the decoders only
+		for (int mode = 0; mode < 3; mode++) {
+			struct frame_result res;
+			memcpy(recv, channel[f], sizeof(recv));
+			t0 = now();
+			decode_frame(recv, DATA_BYTES, RS_FRAMES, 0, mode, out, &res);
+			t[mode] += now() - t0;
+			if (memcmp(out, data, DATA_BYTES) == 0)
+				good[mode]++;
+			if (mode == 0) {
+				erased += res.erased;
+				suspect += res.suspect;
+			}
+		}
+	}
+
+	printf("%ld frames, bit error rate %g: %.2f erased and %.2f suspect symbols per frame\n",
+		frames, ber, (double)erased / frames, (double)suspect / frames);
+	for (int mode = 0; mode < 3; mode++)
+		printf("%-18s %6.2f%% of frames decoded  %8.1f us per frame\n", names[mode],
+			100.0 * good[mode] / frames, 1e6 * t[mode] / frames);
+
+	// the same frames in one bit stream behind sync words, every other
+	// one inverted: the sync word alone must tell decode_frame_bits()
+	// which, so it decodes as many as decode_frame() told the polarity
+	long frame_bits = SYNC_BPSK_BITS + 10L * SYMBOLS, nbits = frames * frame_bits, acquired = 0;
+	uint64_t *stream = calloc(nbits / 64 + 1, sizeof(uint64_t));
+	if (stream == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (long f = 0, n = 0; f < frames; f++)
+		for (int k = 0; k <= SYMBOLS; k++) {
+			int len = k == 0 ? SYNC_BPSK_BITS : 10;
+			long word = k == 0 ? SYNC_BPSK : channel[f][k - 1];
+			for (int b = len - 1; b >= 0; b--, n++)
+				if ((word >> b & 1) ^ (f & 1) ^ (k == 0 && rand() < ber * RAND_MAX))
+					stream[n / 64] |= 1ULL << (63 - n % 64);
+		}
+	t0 = now();
+	for (long f = 0; f < frames; f++) {
+		struct frame_result res;
+		int ok = decode_frame_bits(stream, nbits, f * frame_bits, SYNC_BPSK, SYNC_BPSK_BITS,
+			DATA_BYTES, RS_FRAMES, DECODE_ERASURES, out, &res) == 0;
+		if (res.inverted != (f & 1)) {
+			printf("FAIL: frame %ld polarity\n", f);
+			return 1;
+		}
+		acquired += ok;
+	}
+	t0 = now() - t0;
+	if (acquired != good[DECODE_ERASURES]) {
+		printf("FAIL: %ld frames decoded from the bit stream, %ld from the symbols\n",
+			acquired, good[DECODE_ERASURES]);
+		return 1;
+	}
+	printf("decode_frame_bits  %6.2f%% of frames decoded  %8.1f us per frame, half inverted\n",
+		100.0 * acquired / frames, 1e6 * t0 / frames);
+	free(stream);
+
+	// the 8b10b decoding on its own
+	t0 = now();
+	for (long f = 0; f < frames; f++)
+		flagged += decode_symbols(channel[f], SYMBOLS, 0, bytes, flags);
+	t0 = now() - t0;
+	printf("decode_symbols     %8.2f ns per symbol  (%ld flagged)\n",
+		1e9 * t0 / (frames * SYMBOLS), flagged);
+
+	// the disparity check alone, fed a few symbols at a time as a
+	// receiver would, must flag the same symbols
+	struct rd_validator v;
+	static unsigned char vflags[SYMBOLS];
+	rd_validator_init(&v, 0);
+	t0 = now();
+	for (long f = 0; f < frames; f++) {
+		for (int k = 0; k < SYMBOLS; k += 100)
+			rd_validate(&v, channel[f] + k, SYMBOLS - k < 100 ? SYMBOLS - k : 100, vflags + k);
+		rd_validator_end_frame(&v);
+	}
+	t0 = now() - t0;
+	printf("rd_validate        %8.2f ns per symbol  %ld of %ld frames bad, %ld invalid,"
+		" %ld disparity errors, first at symbol %ld\n",
+		1e9 * t0 / (frames * SYMBOLS), v.file.bad_frames, v.file.frames,
+		v.file.invalid, v.file.disparity, v.file.first_error);
+	for (long f = 0; f < frames && f < 50; f++) {
+		decode_symbols(channel[f], SYMBOLS, 0, bytes, flags);
+		rd_validator_init(&v, 0);
+		rd_validate(&v, channel[f], SYMBOLS, vflags);
+		if (memcmp(flags, vflags, SYMBOLS) != 0) {
+			printf("FAIL: rd_validate() flags differ from decode_symbols() in frame %ld\n", f);
+			return 1;
+		}
+	}
+	free(channel);
+	return 0;
+}
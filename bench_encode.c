@@ -0,0 +1,124 @@
+/* bench_encode.c
+ * 8b10b batch encoding a byte or two bytes per lookup: checks that both
+ * give the symbols of encode_8b10b(), then times runs of each length
+ * from a cold cache (as when a frame is encoded between other work) and
+ * a warm one, to find the run length where the 512 KB pair table wins.
+ *
+ * gcc -O2 -o bench_encode bench_encode.c decoder.c interleave.c rs.c
+ * ./bench_encode [max bytes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "make_wav.h"
+
+#define SCRUB_BYTES (32 << 20)	// more than any last level cache
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static unsigned char *scrub;
+static volatile unsigned char sink;
+
+// Evict the encoder tables by walking a buffer bigger than the caches
+static void flush_caches(void)
+{
+	unsigned char x = 0;
+
+	for (long i = 0; i < SCRUB_BYTES; i += 64) {
+		scrub[i]++;
+		x ^= scrub[i];
+	}
+	sink = x;
+}
+
+// Best of a few timings of one encode_8b10b_packed() call, ns per byte
+static double time_run(uint32_t *out, const unsigned char *data, int n, int cold)
+{
+	double best = 1e30;
+	int reps = cold ? 9 : 9 * (1 + (1 << 20) / n);
+
+	for (int r = 0; r < reps; r++) {
+		int32_t rd = 0;
+		double t0;
+		if (cold)
+			flush_caches();
+		t0 = now();
+		encode_8b10b_packed(out, 0, data, n, &rd);
+		t0 = now() - t0;
+		if (t0 < best)
+			best = t0;
+	}
+	return best * 1e9 / n;
+}
+
+int main(int argc, char * argv[])
+{
+	int max = argc > 1 ? atoi(argv[1]) : 1 << 22;
+	unsigned char *data;
+	uint32_t *single, *pairs;
+	int32_t rd = 0, rd1, rd2;
+
+	if (max < 1)
+		max = 1;
+	data = malloc(max);
+	single = malloc(LONGWORDS(max) * sizeof(uint32_t));
+	pairs = malloc(LONGWORDS(max) * sizeof(uint32_t));
+	scrub = calloc(SCRUB_BYTES, 1);
+	if (data == NULL || single == NULL || pairs == NULL || scrub == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	srand(1);
+	for (int k = 0; k < max; k++)
+		data[k] = rand();
+
+	// the same symbols and RD as a byte at a time, from any start symbol
+	for (int start = 0; start < 3; start++) {
+		int n = max < 5000 ? max : 5000;
+		rd1 = rd2 = 1;
+		encode_8b10b_select(-1);
+		encode_8b10b_packed(single, start, data, n, &rd1);
+		encode_8b10b_select(1);
+		encode_8b10b_packed(pairs, start, data, n, &rd2);
+		rd = 1;
+		for (int k = 0; k < n; k++)
+			if (get10b_packed(single, start + k) != encode_8b10b(&rd, data[k])
+				|| get10b_packed(pairs, start + k) != get10b_packed(single, start + k)) {
+				printf("FAIL: symbol %d from %d\n", k, start);
+				return 1;
+			}
+		if (rd1 != rd || rd2 != rd) {
+			printf("FAIL: RD after %d bytes from %d\n", n, start);
+			return 1;
+		}
+	}
+	printf("packed encoders match encode_8b10b()\n\n");
+
+	printf("%10s %22s %22s\n", "", "cold ns/byte", "warm ns/byte");
+	printf("%10s %11s %10s %11s %10s\n", "bytes", "byte", "pair", "byte", "pair");
+	for (int n = 64; n <= max; n *= 4) {
+		double t[4];
+		for (int cold = 1; cold >= 0; cold--) {
+			encode_8b10b_select(-1);
+			t[2 * !cold] = time_run(single, data, n, cold);
+			encode_8b10b_select(1);
+			t[2 * !cold + 1] = time_run(pairs, data, n, cold);
+		}
+		printf("%10d %11.2f %10.2f %11.2f %10.2f\n", n, t[0], t[1], t[2], t[3]);
+	}
+	printf("\nruns of %d bytes or more use the pair table by default\n", ENCODE_PAIR_MIN);
+	free(data);
+	free(single);
+	free(pairs);
+	free(scrub);
+	return 0;
+}
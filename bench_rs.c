@@ -0,0 +1,426 @@
+/* bench_rs.c
+ * Check the table-driven, rotating-register and batch (SIMD and
+ * bit-sliced) Reed-Solomon encoders against update_rs() and compare
+ * their throughput, then check and time rs_decode() on codewords with
+ * errors and erasures, and the same for dual basis codewords.
+ *
+ * gcc -O2 -o bench_rs bench_rs.c rs.c
+ * ./bench_rs [codewords]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "make_wav.h"
+#include "rs.h"
+
+#define CODEWORD_DATA 223
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Encode n codewords of data with encoder, returning a checksum of the parities
+static unsigned long run(void (*encoder)(unsigned char *, unsigned char),
+	const unsigned char *data, long n, int len)
+{
+	unsigned char parity[NP];
+	unsigned long sum = 0;
+
+	for (long w = 0; w < n; w++) {
+		memset(parity, 0, sizeof(parity));
+		for (int i = 0; i < len; i++)
+			encoder(parity, data[(w * len + i) & 0xffff]);
+		for (int k = 0; k < NP; k++)
+			sum = sum * 31 + parity[k];
+	}
+	return sum;
+}
+
+// The same with struct rs_encoder
+static unsigned long run_encoder(const unsigned char *data, long n, int len)
+{
+	struct rs_encoder enc;
+	unsigned char parity[NP];
+	unsigned long sum = 0;
+
+	for (long w = 0; w < n; w++) {
+		rs_encoder_init(&enc);
+		for (int i = 0; i < len; i++)
+			rs_encoder_update(&enc, data[(w * len + i) & 0xffff]);
+		rs_encoder_parity(&enc, parity);
+		for (int k = 0; k < NP; k++)
+			sum = sum * 31 + parity[k];
+	}
+	return sum;
+}
+
+static const int kernels[] = { 1, 16, 32, 64, 256 };	// lanes of each kernel; 64 and 256 bit-sliced
+
+// Every batch kernel against update_rs(), then timed on n codewords
+static int bench_batch(const unsigned char *data, long n, double t_ref)
+{
+	static const int counts[] = { 1, 3, 15, 16, 17, 33, 65, 100, 257, 300 };
+	static const int lengths[] = { CODEWORD_DATA, 159, 158, 64, 1 };
+	unsigned char (*ref)[NP], (*out)[NP];
+	unsigned char *words;
+	long max = n > 300 ? n : 300;
+	int lanes;
+
+	ref = malloc(max * NP);
+	out = malloc(max * NP);
+	words = malloc(max * CODEWORD_DATA);
+	if (ref == NULL || out == NULL || words == NULL) {
+		printf("Out of memory\n");
+		return 1;
+	}
+	for (long i = 0; i < max * CODEWORD_DATA; i++)
+		words[i] = data[i & 0xffff] ^ (i >> 16);
+
+	for (int k = 0; k < 5; k++) {
+		if ((lanes = rs_batch_select(kernels[k])) != kernels[k])
+			continue;	// not on this CPU
+		for (int l = 0; l < 5; l++)
+			for (int c = 0; c < 10; c++) {
+				int len = lengths[l];
+				rs_encode_batch(out, words, counts[c], len);
+				for (int w = 0; w < counts[c]; w++) {
+					memset(ref[w], 0, NP);
+					for (int i = 0; i < len; i++)
+						update_rs(ref[w], words[w * len + i]);
+				}
+				if (memcmp(ref, out, counts[c] * NP) != 0) {
+					printf("MISMATCH: %d lanes, %d codewords of %d bytes\n",
+						lanes, counts[c], len);
+					return 1;
+				}
+			}
+		printf("rs_encode_batch matches update_rs with %d lanes\n", lanes);
+	}
+
+	for (int k = 0; k < 5; k++) {
+		double t0, t1;
+		if ((lanes = rs_batch_select(kernels[k])) != kernels[k])
+			continue;
+		t0 = now();
+		rs_encode_batch(out, words, n, CODEWORD_DATA);
+		t1 = now();
+		printf("rs_encode_batch %8.1f MB/s  (%.1fx)  %d lanes\n",
+			n * CODEWORD_DATA / (t1 - t0) / 1e6, t_ref / (t1 - t0), lanes);
+	}
+	free(ref);
+	free(out);
+	free(words);
+	return 0;
+}
+
+// Encode a random codeword of len data bytes into cw with update_rs()
+static void random_codeword(unsigned char *cw, int len)
+{
+	memset(cw + len, 0, NP);
+	for (int i = 0; i < len; i++) {
+		cw[i] = rand();
+		update_rs(cw + len, cw[i]);
+	}
+}
+
+// Corrupt e distinct bytes of cw, the first f of them listed as erasures
+static void corrupt(unsigned char *cw, int len, int e, int f, int *eras_pos)
+{
+	int pos[NP + 1], n = 0;
+
+	while (n < e) {
+		int p = rand() % (len + NP), dup = 0;
+		for (int i = 0; i < n; i++)
+			dup |= pos[i] == p;
+		if (dup)
+			continue;
+		pos[n] = p;
+		if (n < f) {
+			eras_pos[n] = p;
+			cw[p] ^= rand() & 0xff;	// an erasure may happen to be right
+		} else
+			cw[p] ^= 1 + rand() % 255;
+		n++;
+	}
+}
+
+// rs_decode() on every length in use at and past its capacity, then timed
+static int bench_decode(long n)
+{
+	static const int lengths[] = { CODEWORD_DATA, 159, 158, 64 };
+	unsigned char cw[CODEWORD_DATA + NP], orig[CODEWORD_DATA + NP];
+	int eras_pos[NP], failed = 0;
+	long bytes;
+	double t0, t1;
+
+	for (int l = 0; l < 4; l++) {
+		int len = lengths[l];
+		for (int trial = 0; trial < 2000; trial++) {
+			int f = rand() % (NP + 1);		// erasures
+			int e = (NP - f) / 2;			// plus as many errors as fit
+			int got;
+			if (trial % 4 == 0)
+				e = rand() % (e + 1);
+			random_codeword(orig, len);
+			memcpy(cw, orig, len + NP);
+			corrupt(cw, len, e + f, f, eras_pos);
+			got = rs_decode(cw, len, eras_pos, f);
+			if (got < 0 || got > e + f || memcmp(cw, orig, len + NP) != 0) {
+				printf("DECODE FAILED: %d data bytes, %d errors, %d erasures, returned %d\n",
+					len, e, f, got);
+				return 1;
+			}
+		}
+		// one error too many must never be "corrected" silently into
+		// something that is not a codeword
+		for (int trial = 0; trial < 500; trial++) {
+			int got;
+			random_codeword(orig, len);
+			memcpy(cw, orig, len + NP);
+			corrupt(cw, len, NP / 2 + 1, 0, eras_pos);
+			if ((got = rs_decode(cw, len, NULL, 0)) < 0)
+				failed++;
+			else {
+				unsigned char check[NP] = { 0 };
+				for (int i = 0; i < len; i++)
+					update_rs(check, cw[i]);
+				if (memcmp(check, cw + len, NP) != 0) {
+					printf("MISCORRECTION to a non-codeword: %d data bytes\n", len);
+					return 1;
+				}
+			}
+		}
+	}
+	printf("rs_decode corrects 2e + f <= 32 at %d, %d, %d and %d bytes; "
+		"%d of 2000 with 17 errors detected\n",
+		lengths[0], lengths[1], lengths[2], lengths[3], failed);
+
+	// every syndrome kernel agrees with plain C at every length
+	for (int k = 1; k < 3; k++) {
+		unsigned char ref[NP], syn[NP], word[255];
+		int lanes = rs_syndrome_select(kernels[k]);
+		if (lanes != kernels[k])
+			continue;
+		for (int len = 1; len <= 255; len++) {
+			int any_ref, any;
+			for (int i = 0; i < len; i++)
+				word[i] = len % 3 == 0 ? 0 : rand();
+			rs_syndrome_select(1);
+			any_ref = rs_syndromes(word, len, ref);
+			rs_syndrome_select(lanes);
+			any = rs_syndromes(word, len, syn);
+			if (memcmp(ref, syn, NP) != 0 || !any != !any_ref) {
+				printf("SYNDROME MISMATCH: %d lanes, %d bytes\n", lanes, len);
+				return 1;
+			}
+		}
+		printf("rs_syndromes matches plain C with %d lanes\n", lanes);
+	}
+
+	random_codeword(orig, CODEWORD_DATA);
+	for (int k = 0; k < 3; k++) {
+		int lanes = rs_syndrome_select(kernels[k]);
+		if (lanes != kernels[k])
+			continue;
+		bytes = 0;
+		t0 = now();
+		for (long w = 0; w < n; w++) {
+			if (rs_decode(orig, CODEWORD_DATA, NULL, 0) != 0)
+				return 1;
+			bytes += CODEWORD_DATA + NP;
+		}
+		t1 = now();
+		printf("rs_decode clean     %8.1f MB/s  %d lanes\n", bytes / (t1 - t0) / 1e6, lanes);
+	}
+
+	// the full length, and the DUV length, where most of the full
+	// code's 255 positions are virtual zeros
+	for (int l = 0; l < 4; l += 3) {
+		int len = lengths[l], size = len + NP;
+		random_codeword(orig, len);
+		t0 = now();
+		for (long w = 0; w < n / 10; w++) {
+			memcpy(cw, orig, size);
+			cw[w % size] ^= 0x55;
+			for (int i = 1; i < NP / 2; i++)
+				cw[(w + i * 13) % size] ^= i;
+			if (rs_decode(cw, len, NULL, 0) != NP / 2)
+				return 1;
+		}
+		t1 = now();
+		printf("rs_decode 16 errors %8.2f us per %d byte codeword\n",
+			(t1 - t0) * 1e6 / (n / 10), len);
+	}
+	return 0;
+}
+
+// The dual basis encoders and decoder against converting around update_rs()
+static int bench_dual(long n)
+{
+	static const unsigned char taltab[4] = { 0x00, 0x7b, 0xaf, 0xd4 };	// from libfec
+	unsigned char cw[CODEWORD_DATA + NP], orig[CODEWORD_DATA + NP], conv[CODEWORD_DATA + NP];
+	unsigned char batch[100][NP], words[100 * CODEWORD_DATA];
+	int eras_pos[NP];
+	struct rs_encoder enc;
+	struct rs_code code;
+	double t0, t1;
+
+	for (int x = 0; x < 4; x++) {
+		unsigned char c = x;
+		rs_to_dual(&c, 1);
+		if (c != taltab[x]) {
+			printf("DUAL BASIS TABLE MISMATCH at %d\n", x);
+			return 1;
+		}
+	}
+	for (int len = 1; len <= CODEWORD_DATA; len++) {
+		for (int i = 0; i < len; i++)
+			orig[i] = rand();
+		memcpy(conv, orig, len);
+		rs_from_dual(conv, len);
+		memset(conv + len, 0, NP);
+		for (int i = 0; i < len; i++)
+			update_rs(conv + len, conv[i]);
+		rs_to_dual(conv + len, NP);
+		rs_encoder_init_basis(&enc, RS_DUAL);
+		for (int i = 0; i < len; i++)
+			rs_encoder_update(&enc, orig[i]);
+		rs_encoder_parity(&enc, orig + len);
+		if (memcmp(orig + len, conv + len, NP) != 0) {
+			printf("DUAL ENCODER MISMATCH: %d bytes\n", len);
+			return 1;
+		}
+	}
+	for (int k = 0; k < 5; k++) {
+		int lanes = rs_batch_select(kernels[k]), len = 159;
+		if (lanes != kernels[k])
+			continue;
+		for (int i = 0; i < 100 * len; i++)
+			words[i] = rand();
+		rs_encode_batch_basis(batch, words, 100, len, RS_DUAL);
+		for (int w = 0; w < 100; w++) {
+			rs_encoder_init_basis(&enc, RS_DUAL);
+			for (int i = 0; i < len; i++)
+				rs_encoder_update(&enc, words[w * len + i]);
+			rs_encoder_parity(&enc, cw);
+			if (memcmp(cw, batch[w], NP) != 0) {
+				printf("DUAL BATCH MISMATCH: %d lanes, codeword %d\n", lanes, w);
+				return 1;
+			}
+		}
+	}
+	printf("dual basis encoders match update_rs between rs_from_dual and rs_to_dual\n");
+
+	for (int k = 0; k < 3; k++) {
+		int lanes = rs_syndrome_select(kernels[k]);
+		if (lanes != kernels[k])
+			continue;
+		for (int trial = 0; trial < 2000; trial++) {
+			int len = trial % 2 ? 159 : 64;
+			int f = rand() % (NP + 1), e = (NP - f) / 2, got;
+			random_codeword(orig, len);
+			rs_to_dual(orig, len + NP);
+			memcpy(cw, orig, len + NP);
+			corrupt(cw, len, e + f, f, eras_pos);
+			rs_code_init_basis(&code, len, RS_DUAL);
+			got = rs_decode_code(&code, cw, eras_pos, f);
+			if (got < 0 || memcmp(cw, orig, len + NP) != 0) {
+				printf("DUAL DECODE FAILED: %d lanes, %d data bytes, %d errors, %d erasures\n",
+					lanes, len, e, f);
+				return 1;
+			}
+		}
+	}
+	printf("dual basis rs_decode_code corrects 2e + f <= 32 with every syndrome kernel\n");
+
+	// the conversion is folded into the tables, so it should cost little
+	rs_batch_select(0);
+	rs_syndrome_select(0);
+	for (int basis = RS_CONVENTIONAL; basis <= RS_DUAL; basis++) {
+		static unsigned char parity[256][NP];
+		long done = 0;
+		t0 = now();
+		for (long w = 0; w < n; w += 256, done += 256)
+			rs_encode_batch_basis(parity, words, 256 < n - w ? 256 : n - w, 64, basis);
+		t1 = now();
+		printf("%-12s batch  %8.1f MB/s", basis == RS_DUAL ? "dual" : "conventional",
+			done * 64 / (t1 - t0) / 1e6);
+		random_codeword(orig, CODEWORD_DATA);
+		if (basis == RS_DUAL)
+			rs_to_dual(orig, CODEWORD_DATA + NP);
+		rs_code_init_basis(&code, CODEWORD_DATA, basis);
+		t0 = now();
+		for (long w = 0; w < n; w++)
+			if (rs_decode_code(&code, orig, NULL, 0) != 0)
+				return 1;
+		t1 = now();
+		printf("   clean decode %8.1f MB/s\n", n * (CODEWORD_DATA + NP) / (t1 - t0) / 1e6);
+	}
+	return 0;
+}
+
+int main(int argc, char * argv[])
+{
+	static const int lengths[] = { CODEWORD_DATA, 159, 158, 64 };
+	static unsigned char data[0x10000];
+	long n = argc > 1 ? atol(argv[1]) : 100000;
+	unsigned char ref[NP], fast[NP], rot[NP];
+	struct rs_encoder enc;
+	unsigned long s1, s2, s3;
+	double t0, t1, t2, t3;
+
+	srand(1);
+	for (int i = 0; i < (int)sizeof(data); i++)
+		data[i] = rand();
+	rs_init();
+
+	// bit-exact on every shortened length in use, byte by byte
+	for (int l = 0; l < 4; l++)
+		for (int w = 0; w < 1000; w++) {
+			memset(ref, 0, sizeof(ref));
+			memset(fast, 0, sizeof(fast));
+			rs_encoder_init(&enc);
+			for (int i = 0; i < lengths[l]; i++) {
+				unsigned char c = w == 0 ? 0 : w == 1 ? 0xff : data[(w * 251 + i) & 0xffff];
+				update_rs(ref, c);
+				update_rs_table(fast, c);
+				rs_encoder_update(&enc, c);
+				rs_encoder_parity(&enc, rot);
+				if (memcmp(ref, fast, NP) != 0 || memcmp(ref, rot, NP) != 0) {
+					printf("MISMATCH: length %d codeword %d byte %d\n", lengths[l], w, i);
+					return 1;
+				}
+			}
+		}
+	printf("update_rs_table and rs_encoder match update_rs\n");
+
+	t0 = now();
+	s1 = run(update_rs, data, n, CODEWORD_DATA);
+	t1 = now();
+	s2 = run(update_rs_table, data, n, CODEWORD_DATA);
+	t2 = now();
+	s3 = run_encoder(data, n, CODEWORD_DATA);
+	t3 = now();
+	if (s1 != s2 || s1 != s3) {
+		printf("MISMATCH in timed run\n");
+		return 1;
+	}
+	printf("%ld codewords of %d bytes\n", n, CODEWORD_DATA);
+	printf("update_rs       %8.1f MB/s\n", n * CODEWORD_DATA / (t1 - t0) / 1e6);
+	printf("update_rs_table %8.1f MB/s  (%.1fx)\n", n * CODEWORD_DATA / (t2 - t1) / 1e6,
+		(t1 - t0) / (t2 - t1));
+	printf("rs_encoder      %8.1f MB/s  (%.1fx)\n", n * CODEWORD_DATA / (t3 - t2) / 1e6,
+		(t1 - t0) / (t3 - t2));
+	if (bench_batch(data, n, t1 - t0) != 0)
+		return 1;
+	if (bench_decode(n) != 0)
+		return 1;
+	return bench_dual(n);
+}
@@ -0,0 +1,229 @@
+/* bench_symbols.c
+ * Packing 10-bit symbols three to a word: checks pack_10b() and
+ * unpack_10b() with every kernel against put10b_packed() and
+ * get10b_packed() at all offsets, then times each way.  Then the two
+ * layouts of struct symbols side by side: memory, and the speed of
+ * 8b10b encoding into them, BPSK synthesis from them and 8b10b decoding
+ * out of them, over frames of random bytes.  The synthesis reads each
+ * frame through a bit_reader, which is checked first.
+ *
+ * gcc -O2 -o bench_symbols bench_symbols.c symbols.c decoder.c interleave.c rs.c synth.c wav.c checksum.c -lm
+ * ./bench_symbols [symbols] [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "make_wav.h"
+#include "symbols.h"
+#include "decoder.h"
+#include "synth.h"
+
+#define FRAME_SYMBOLS (476 + 3 * NP)	// BPSK
+#define SYNTH_FRAMES 20			// at 48 kHz, 4.6 M samples
+
+static const int kernels[] = { 32, 128, 256 };
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int check(int bits)
+{
+	enum { N = 200 };
+	uint16_t sym[N], back[N];
+	uint32_t ref[LONGWORDS(N) + 1], got[LONGWORDS(N) + 1];
+
+	for (int k = 0; k < N; k++)
+		sym[k] = rand() & CHARACTER_MASK;
+	for (int index = 0; index < 6; index++)
+		for (int count = 0; index + count <= N; count++) {
+			// earlier symbols in the first word are kept, later ones dropped
+			for (int w = 0; w < LONGWORDS(N) + 1; w++)
+				ref[w] = got[w] = rand();
+			for (int k = 0; k < index; k++) {
+				put10b_packed(ref, k, sym[N - 1 - k]);
+				put10b_packed(got, k, sym[N - 1 - k]);
+			}
+			for (int k = 0; k < count; k++)
+				put10b_packed(ref, index + k, sym[k]);
+			pack_10b(got, index, sym, count);
+			if (memcmp(ref, got, LONGWORDS(index + count) * sizeof(uint32_t))) {
+				printf("FAIL: pack_10b(%d bit) of %d from %d\n", bits, count, index);
+				return 1;
+			}
+			unpack_10b(back, got, index, count);
+			if (memcmp(back, sym, count * sizeof(uint16_t))) {
+				printf("FAIL: unpack_10b(%d bit) of %d from %d\n", bits, count, index);
+				return 1;
+			}
+		}
+	return 0;
+}
+
+// The bit reader gives the sync word then every symbol, MSB first
+static int check_reader(const struct symbols *b, int count)
+{
+	struct bit_reader r;
+	uint16_t sym[FRAME_SYMBOLS];
+	long n = 0, want = SYNC_BPSK_BITS + 10L * count;
+	int bit, k;
+
+	symbols_get(b, sym, 0, count);
+	bit_reader_init(&r, SYNC_BPSK, SYNC_BPSK_BITS, b, count);
+	while ((k = bit_reader_run(&r, &bit)) > 0)
+		for (; k > 0; k--, n++) {
+			int expect = n < SYNC_BPSK_BITS ? SYNC_BPSK >> (SYNC_BPSK_BITS - 1 - n) & 1
+				: sym[(n - SYNC_BPSK_BITS) / 10] >> (9 - (n - SYNC_BPSK_BITS) % 10) & 1;
+			if (n >= want || bit != expect)
+				return 1;
+		}
+	return n != want;
+}
+
+// Encode, synthesize and decode frames with symbols in layout
+static int bench_layout(int layout, const char *name, long frames, const unsigned char *data)
+{
+	struct symbols *buf = malloc(frames * sizeof(struct symbols));
+	static uint16_t tmp[FRAME_SYMBOLS];
+	static unsigned char bytes[FRAME_SYMBOLS], flags[FRAME_SYMBOLS];
+	struct synth s;
+	double te, ts, td;
+	long nsyn = frames < SYNTH_FRAMES ? frames : SYNTH_FRAMES;
+
+	if (buf == NULL)
+		return -1;
+	for (long f = 0; f < frames; f++)
+		if (symbols_init(&buf[f], layout, FRAME_SYMBOLS) != 0)
+			return -1;
+
+	te = now();
+	for (long f = 0; f < frames; f++) {
+		int32_t rd = 0;
+		symbols_encode(&buf[f], 0, data + f * FRAME_SYMBOLS, FRAME_SYMBOLS, &rd);
+	}
+	te = now() - te;
+	if (check_reader(&buf[0], FRAME_SYMBOLS) != 0) {
+		printf("FAIL: %s bit reader\n", name);
+		return -1;
+	}
+
+	if (synth_init(&s, 48000, WAV_S16, 1200, 0, nsyn * 10L * FRAME_SYMBOLS) != 0)
+		return -1;
+	s.nco = 1;
+	ts = now();
+	for (long f = 0; f < nsyn; f++)
+		synth_symbols(&s, &buf[f], FRAME_SYMBOLS);
+	ts = now() - ts;
+	synth_free(&s);
+
+	// uint16_t symbols are decoded where they are, packed ones unpacked first
+	td = now();
+	for (long f = 0; f < frames; f++) {
+		const short int *words = buf[f].data;
+		if (layout != SYMBOLS_U16) {
+			symbols_get(&buf[f], tmp, 0, FRAME_SYMBOLS);
+			words = (const short int *)tmp;
+		}
+		decode_symbols(words, FRAME_SYMBOLS, 0, bytes, flags);
+		if (memcmp(bytes, data + f * FRAME_SYMBOLS, FRAME_SYMBOLS) != 0) {
+			printf("FAIL: %s frame %ld does not decode\n", name, f);
+			return -1;
+		}
+	}
+	td = now() - td;
+
+	printf("%-7s %9ld %12.2f %12.2f %12.2f\n", name, symbols_size(layout, FRAME_SYMBOLS),
+		1e9 * te / (frames * FRAME_SYMBOLS), 1e9 * ts / (nsyn * FRAME_SYMBOLS),
+		1e9 * td / (frames * FRAME_SYMBOLS));
+	for (long f = 0; f < frames; f++)
+		symbols_free(&buf[f]);
+	free(buf);
+	return 0;
+}
+
+int main(int argc, char * argv[])
+{
+	int n = argc > 1 ? atoi(argv[1]) : 1 << 16;
+	long frames = argc > 2 ? atol(argv[2]) : 2000;
+	unsigned char *data;
+	uint16_t *sym, *back;
+	uint32_t *packed;
+	double t, reps;
+
+	if (n < 1)
+		n = 1;
+	sym = malloc(n * sizeof(uint16_t));
+	back = malloc(n * sizeof(uint16_t));
+	packed = malloc(LONGWORDS(n) * sizeof(uint32_t));
+	if (sym == NULL || back == NULL || packed == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	srand(1);
+	for (int k = 0; k < n; k++)
+		sym[k] = rand() & CHARACTER_MASK;
+
+	for (int i = 0; i < 3; i++) {
+		if (symbols_select(kernels[i]) != kernels[i])
+			continue;
+		if (check(kernels[i]))
+			return 1;
+	}
+	printf("pack_10b() and unpack_10b() match put10b_packed() and get10b_packed()\n\n");
+
+	printf("%-22s %8s %8s\n", "ns per symbol", "pack", "unpack");
+	for (reps = 0, t = now(); now() - t < 0.3; reps++) {
+		for (int k = 0; k < n; k++)
+			put10b_packed(packed, k, sym[k]);
+		for (int k = 0; k < n; k++)
+			back[k] = get10b_packed(packed, k);
+	}
+	printf("%-22s %8.3f %8s\n", "put/get10b_packed", (now() - t) * 1e9 / reps / n, "(both)");
+	for (int i = 0; i < 3; i++) {
+		double tp, tu;
+		if (symbols_select(kernels[i]) != kernels[i])
+			continue;
+		for (reps = 0, t = now(); now() - t < 0.3; reps++)
+			pack_10b(packed, 0, sym, n);
+		tp = (now() - t) * 1e9 / reps / n;
+		for (reps = 0, t = now(); now() - t < 0.3; reps++)
+			unpack_10b(back, packed, 0, n);
+		tu = (now() - t) * 1e9 / reps / n;
+		printf("%3d bit %-14s %8.3f %8.3f\n", kernels[i], "kernels", tp, tu);
+	}
+	if (memcmp(back, sym, n * sizeof(uint16_t))) {
+		printf("FAIL: round trip\n");
+		return 1;
+	}
+
+	symbols_select(0);
+	if (frames < 1)
+		frames = 1;
+	data = malloc(frames * FRAME_SYMBOLS);
+	if (data == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	for (long k = 0; k < frames * FRAME_SYMBOLS; k++)
+		data[k] = rand();
+	printf("\n%ld frames of %d symbols\n", frames, FRAME_SYMBOLS);
+	printf("%-7s %9s %12s %12s %12s\n", "layout", "bytes", "encode ns", "synth ns", "decode ns");
+	if (bench_layout(SYMBOLS_PACKED, "packed", frames, data) != 0
+		|| bench_layout(SYMBOLS_U16, "u16", frames, data) != 0) {
+		printf("FAIL: out of memory or bad decode\n");
+		return 1;
+	}
+	printf("(ns per symbol)\n");
+	free(data);
+	free(sym);
+	free(back);
+	free(packed);
+	return 0;
+}
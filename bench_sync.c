@@ -0,0 +1,153 @@
+/* bench_sync.c
+ * Frame acquisition speed: a stream of BPSK frames (31-bit sync word) and
+ * one of DUV frames (K.28.5 sync) go through a channel with random bit
+ * errors and half the frames inverted, then find_sync() and find_commas()
+ * look for the sync words.  Both are checked against a bit at a time
+ * search, and the speed is given as a multiple of real time.
+ *
+ * gcc -O2 -o bench_sync bench_sync.c decoder.c interleave.c rs.c
+ * ./bench_sync [frames] [bit error rate]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "make_wav.h"
+#include "decoder.h"
+
+#define MAX_SYMBOLS (476 + 3 * NP)
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void put_bits(uint64_t *bits, long *n, uint64_t word, int len)
+{
+	for (int b = len - 1; b >= 0; b--, (*n)++)
+		if (word >> b & 1)
+			bits[*n / 64] |= 1ULL << (63 - *n % 64);
+}
+
+static int get_bit(const uint64_t *bits, long n)
+{
+	return bits[n / 64] >> (63 - n % 64) & 1;
+}
+
+// Sync word, then the symbols of random bytes; every other frame inverted
+static long make_stream(uint64_t *bits, long frames, long sync, int sync_bits,
+	int symbols, double ber)
+{
+	unsigned char data[MAX_SYMBOLS];
+	uint32_t packed[LONGWORDS(MAX_SYMBOLS)];
+	long n = 0;
+
+	for (long f = 0; f < frames; f++) {
+		long start = n;
+		int32_t rd = 0;
+		for (int k = 0; k < symbols; k++)
+			data[k] = rand();
+		encode_8b10b_packed(packed, 0, data, symbols, &rd);
+		put_bits(bits, &n, sync, sync_bits);
+		for (int k = 0; k < symbols; k++)
+			put_bits(bits, &n, get10b_packed(packed, k), 10);
+		for (long b = start; b < n; b++)
+			if ((f & 1) ^ (rand() < ber * RAND_MAX))
+				bits[b / 64] ^= 1ULL << (63 - b % 64);
+	}
+	return n;
+}
+
+// The same search a bit at a time
+static long slow_search(const uint64_t *bits, long nbits, uint64_t pattern, int len,
+	long *pos, unsigned char *inverted, long max)
+{
+	long found = 0;
+
+	for (long p = 0; p + len <= nbits; p++) {
+		int same = 1, other = 1;
+		for (int j = 0; j < len; j++) {
+			int b = get_bit(bits, p + j), want = pattern >> (len - 1 - j) & 1;
+			same &= b == want;
+			other &= b != want;
+		}
+		if (same || other) {
+			if (found < max) {
+				pos[found] = p;
+				inverted[found] = other;
+			}
+			found++;
+		}
+	}
+	return found;
+}
+
+static int run(const char *name, long frames, long sync, int sync_bits, int symbols,
+	int bit_rate, double ber, int commas)
+{
+	long frame_bits = sync_bits + 10L * symbols;
+	long max = frames * 4 + 16, nbits, found, expect, hits = 0, inv = 0;
+	uint64_t *bits = calloc(frames * frame_bits / 64 + 2, sizeof(uint64_t));
+	long *pos = malloc(max * sizeof(long)), *pos2 = malloc(max * sizeof(long));
+	unsigned char *flag = malloc(max), *flag2 = malloc(max);
+	double t, reps = 0;
+
+	if (bits == NULL || pos == NULL || pos2 == NULL || flag == NULL || flag2 == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	nbits = make_stream(bits, frames, sync, sync_bits, symbols, ber);
+
+	found = commas ? find_commas(bits, nbits, pos, flag, max)
+		: find_sync(bits, nbits, sync, sync_bits, pos, flag, max);
+	expect = slow_search(bits, nbits, sync, sync_bits, pos2, flag2, max);
+	if (found != expect || memcmp(pos, pos2, (found < max ? found : max) * sizeof(long))
+		|| memcmp(flag, flag2, found < max ? found : max)) {
+		printf("FAIL: %s search differs from the bit at a time one\n", name);
+		return 1;
+	}
+	for (long k = 0; k < found && k < max; k++)
+		if (pos[k] % frame_bits == 0) {
+			hits++;
+			inv += flag[k];
+		}
+
+	t = now();
+	do {
+		if (commas)
+			find_commas(bits, nbits, pos, flag, max);
+		else
+			find_sync(bits, nbits, sync, sync_bits, pos, flag, max);
+		reps++;
+	} while (now() - t < 0.5);
+	t = (now() - t) / reps;
+
+	printf("%-5s %ld frames: %ld sync words found, %ld at frame starts (%ld inverted)\n",
+		name, frames, found, hits, inv);
+	printf("      %.0f Mbit/s, %.0f times real time at %d bit/s\n",
+		nbits / t * 1e-6, nbits / t / bit_rate, bit_rate);
+	free(bits);
+	free(pos);
+	free(pos2);
+	free(flag);
+	free(flag2);
+	return 0;
+}
+
+int main(int argc, char * argv[])
+{
+	long frames = argc > 1 ? atol(argv[1]) : 2000;
+	double ber = argc > 2 ? atof(argv[2]) : 0.001;
+
+	srand(1);
+	if (run("BPSK", frames, SYNC_BPSK, SYNC_BPSK_BITS, 476 + 3 * NP, 1200, ber, 0))
+		return 1;
+	if (run("DUV", frames, SYNC_DUV, SYNC_DUV_BITS, 64 + NP, 200, ber, 1))
+		return 1;
+	return 0;
+}
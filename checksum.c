@@ -0,0 +1,152 @@
+/* checksum.c
+ * XXH64, see checksum.h
+ */
+
+#include <string.h>
+
+#include "checksum.h"
+
+#define PRIME64_1 0x9E3779B185EBCA87ULL
+#define PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME64_3 0x165667B19E3779F9ULL
+#define PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define PRIME64_5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t rotl64(uint64_t x, int r)
+{
+	return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t read64(const unsigned char *p)
+{
+	return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24
+		| (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+}
+
+static inline uint32_t read32(const unsigned char *p)
+{
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint64_t round64(uint64_t acc, uint64_t input)
+{
+	acc += input * PRIME64_2;
+	acc = rotl64(acc, 31);
+	return acc * PRIME64_1;
+}
+
+static inline uint64_t merge64(uint64_t acc, uint64_t val)
+{
+	acc ^= round64(0, val);
+	return acc * PRIME64_1 + PRIME64_4;
+}
+
+void xxh64_reset(struct xxh64_state *st, uint64_t seed)
+{
+	memset(st, 0, sizeof(*st));
+	st->seed = seed;
+	st->v[0] = seed + PRIME64_1 + PRIME64_2;
+	st->v[1] = seed + PRIME64_2;
+	st->v[2] = seed;
+	st->v[3] = seed - PRIME64_1;
+}
+
+// Fold whole 32-byte stripes into the four lanes
+static const unsigned char *stripes(struct xxh64_state *st, const unsigned char *p, const unsigned char *end)
+{
+	while (p + 32 <= end) {
+		st->v[0] = round64(st->v[0], read64(p));
+		st->v[1] = round64(st->v[1], read64(p + 8));
+		st->v[2] = round64(st->v[2], read64(p + 16));
+		st->v[3] = round64(st->v[3], read64(p + 24));
+		p += 32;
+	}
+	return p;
+}
+
+void xxh64_update(struct xxh64_state *st, const void *data, unsigned long len)
+{
+	const unsigned char *p = data, *end = p + len;
+
+	st->total_len += len;
+	if (st->memsize + len < 32) {
+		memcpy(st->mem + st->memsize, p, len);
+		st->memsize += len;
+		return;
+	}
+	if (st->memsize) {
+		unsigned int fill = 32 - st->memsize;
+		memcpy(st->mem + st->memsize, p, fill);
+		stripes(st, st->mem, st->mem + 32);
+		p += fill;
+		st->memsize = 0;
+	}
+	p = stripes(st, p, end);
+	if (p < end) {
+		memcpy(st->mem, p, end - p);
+		st->memsize = end - p;
+	}
+}
+
+uint64_t xxh64_digest(const struct xxh64_state *st)
+{
+	const unsigned char *p = st->mem, *end = p + st->memsize;
+	uint64_t h;
+
+	if (st->total_len >= 32) {
+		h = rotl64(st->v[0], 1) + rotl64(st->v[1], 7) + rotl64(st->v[2], 12) + rotl64(st->v[3], 18);
+		h = merge64(h, st->v[0]);
+		h = merge64(h, st->v[1]);
+		h = merge64(h, st->v[2]);
+		h = merge64(h, st->v[3]);
+	} else
+		h = st->seed + PRIME64_5;
+	h += st->total_len;
+
+	while (p + 8 <= end) {
+		h ^= round64(0, read64(p));
+		h = rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+		p += 8;
+	}
+	if (p + 4 <= end) {
+		h ^= (uint64_t)read32(p) * PRIME64_1;
+		h = rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+		p += 4;
+	}
+	while (p < end) {
+		h ^= *p++ * PRIME64_5;
+		h = rotl64(h, 11) * PRIME64_1;
+	}
+
+	h ^= h >> 33;
+	h *= PRIME64_2;
+	h ^= h >> 29;
+	h *= PRIME64_3;
+	h ^= h >> 32;
+	return h;
+}
+
+uint64_t xxh64(const void *data, unsigned long len, uint64_t seed)
+{
+	struct xxh64_state st;
+
+	xxh64_reset(&st, seed);
+	xxh64_update(&st, data, len);
+	return xxh64_digest(&st);
+}
+
+void xxh64_update_samples(struct xxh64_state *st, const short int *samples, unsigned long n)
+{
+	unsigned char le[512];
+
+	while (n > 0) {
+		unsigned long k = n > sizeof(le) / 2 ? sizeof(le) / 2 : n;
+		for (unsigned long i = 0; i < k; i++) {
+			le[2 * i] = samples[i] & 0xff;
+			le[2 * i + 1] = (samples[i] >> 8) & 0xff;
+		}
+		xxh64_update(st, le, 2 * k);
+		samples += k;
+		n -= k;
+	}
+}
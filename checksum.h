@@ -0,0 +1,33 @@
+/* checksum.h
+ * XXH64 checksums of rendered samples, used to tell whether two renders
+ * are bit-identical without keeping or diffing the WAV files.
+ *
+ * This is the XXH64 algorithm by Yann Collet (BSD 2-clause), written out
+ * here so the generator keeps building from a handful of .c files.
+ */
+
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <stdint.h>
+
+struct xxh64_state {
+	uint64_t total_len;
+	uint64_t v[4];
+	unsigned char mem[32];	// bytes not yet folded into v[]
+	unsigned int memsize;
+	uint64_t seed;
+};
+
+uint64_t xxh64(const void *data, unsigned long len, uint64_t seed);
+    /* one-shot hash of len bytes */
+
+void xxh64_reset(struct xxh64_state *st, uint64_t seed);
+void xxh64_update(struct xxh64_state *st, const void *data, unsigned long len);
+uint64_t xxh64_digest(const struct xxh64_state *st);
+
+void xxh64_update_samples(struct xxh64_state *st, const short int *samples, unsigned long n);
+    /* hash n 16-bit samples as little endian bytes, whatever the host order,
+       so checksums agree across hosts */
+
+#endif /* CHECKSUM_H */
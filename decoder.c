@@ -27,14 +27,13 @@
  */
 // class Code8b10b {
 #include <stdio.h>
-#define false 0
-#define true 1
-
-static int getNextRd(int word, int flip);
-static int getRdSense10b(int word, int flip);
-static char decode(int word, int flip);
-static void printAll10bwords();
-static int encode(int word);	 
+#include <string.h>
+
+#include "make_wav.h"
+#include "rs.h"
+#include "decoder.h"
+#include "interleave.h"
+
 	
 	 static  int NOT_FRAME = /* 0fa */ 0xfa & 0x3ff;
 	 static  int FRAME = /* 0fa */ ~0xfa & 0x3ff;
@@ -559,92 +558,424 @@ static int encode(int word);
 		} };
 	
 	/**
-	 * Given a 10 bit word, look it up in the Encode_8b10b matrix and return the value
-	 * @param word - the 10 bit word
-	 * @return - the value returned 
-	 * @throws LookupException 
-	 * 
+	 * Decode_8b10b[flip][word] is everything about a received 10 bit word,
+	 * inverted first if flip, in one lookup instead of a search of all 512
+	 * codewords: the byte, the RDs it is a codeword for (a balanced word is
+	 * one for both), the RD after it for each, and whether it is the K.28.5
+	 * comma.  A comma is not data, so it has neither DEC_RD bit.
 	 */
-	 static char decode(int word, int flip) { // throws LookupException {
-		if (flip) word = ~word & 0x3ff;
+#define DEC_BYTE	0xff	/* the byte it encodes */
+#define DEC_RD0		0x100	/* a codeword for RD -1 */
+#define DEC_RD1		0x200	/* a codeword for RD +1 */
+#define DEC_NEXT0	0x400	/* taken at RD -1, the RD after it is +1 */
+#define DEC_NEXT1	0x800	/* taken at RD +1, the RD after it is +1 */
+#define DEC_COMMA	0x1000	/* K.28.5 */
+	 static uint16_t Decode_8b10b[2][1024];
+	 static struct interleaver Frame_layout[2];	// BPSK and DUV
+	 static int decodeReady;
+
+	 void decode_init(void) {
+		if (decodeReady) return;
 		for (int rd=0; rd<2; rd++)
 			for (int i=0; i<256; i++) {
-				int testValue = Encode_8b10b[rd][i];
-				if ((testValue & 0x3ff) == word) {				
-					return (char)i; // return the position in the lookup table where we found the code word
+				int word = Encode_8b10b[rd][i] & 0x3ff;
+				int next = (Encode_8b10b[rd][i] >> 10) & 1;
+				Decode_8b10b[0][word] |= i | (DEC_RD0 << rd) | (next ? DEC_NEXT0 << rd : 0);
+			}
+		Decode_8b10b[0][NOT_FRAME] = 0xbc | DEC_COMMA | DEC_NEXT0;
+		Decode_8b10b[0][FRAME] = 0xbc | DEC_COMMA;
+		for (int word=0; word<1024; word++)
+			Decode_8b10b[1][word] = Decode_8b10b[0][~word & 0x3ff];
+		interleaver_init(&Frame_layout[0], 476, 3);
+		interleaver_init(&Frame_layout[1], 64, 1);
+		decodeReady = 1;
+	}
+
+//}
+
+	/**
+	 * The encoder declared in make_wav.h: data -1 gives the K.28.5 comma
+	 */
+	 int encode_8b10b(int32_t *state, int32_t data) {
+		int word;
+
+		if (data < 0) {
+			word = *state ? FRAME : NOT_FRAME;
+			*state ^= 1;	// K.28.5 is unbalanced
+			return word;
+		}
+		word = Encode_8b10b[*state][data & 0xff];
+		*state = (word >> 10) & 1;
+		return word & 0x3ff;
+	}
+
+	/**
+	 * Two bytes at a time: the 20 bits of both words, first in the low
+	 * bits, and the RD after them in bit 20, indexed by the RD before
+	 * them and first | second << 8.  At 512 KB it only beats the 1 KB
+	 * table on runs long enough to pay for the cache misses, see
+	 * bench_encode.c
+	 *
+	 * Every codeword either keeps the RD or flips it, whichever RD it was
+	 * encoded from, so the RD after a byte (or pair) is the RD before it
+	 * xor the flip found in the RD -1 row.  The encoders below chain the
+	 * RD through that xor instead of through the load of each word.
+	 */
+	 static uint32_t Encode_pairs[2][65536];
+	 static int pairsReady;
+	 static int pairMin = ENCODE_PAIR_MIN;
+
+	 static void encode_pairs_init(void) {
+		if (pairsReady) return;
+		for (int rd=0; rd<2; rd++)
+			for (int b0=0; b0<256; b0++) {
+				int w0 = Encode_8b10b[rd][b0];
+				for (int b1=0; b1<256; b1++) {
+					int w1 = Encode_8b10b[(w0 >> 10) & 1][b1];
+					Encode_pairs[rd][b0 | b1 << 8] = (w0 & 0x3ff) | (w1 & 0x3ff) << 10
+						| ((w1 >> 10) & 1) << 20;
 				}
 			}
-		return 0;
-//		throw new LookupException();
+		pairsReady = 1;
 	}
-	
-	 static void printAll10bwords() {
-		for (int rd=0; rd<2; rd++) {
-			printf("************* RD: %d ", rd);
-			for (int i=0; i<256; i++) {
-				int testValue = Encode_8b10b[rd][i];
-				printf("Encode_8b10b[%d][%d]: %d ", rd, i, testValue);
-				int nextRd = getNextRd(testValue, false);
-				printf(" Next RD: %d \n", nextRd);
-//				testValue = testValue & 0x3ff;				
-//				int[] bit10b = FoxBitStrtestValue);
-//				for (int j=0; j < bit10b.length; j++)
-//					if (bit10b[j]) printf(1 + " "); else printf(0 + " ");
-//				printf(" Next rd: %d", nextRd);
+
+	 int encode_8b10b_select(int min_bytes) {
+		if (min_bytes)
+			pairMin = min_bytes;
+		return pairMin;
+	}
+
+	/**
+	 * Encode count bytes into buffer from symbol index on, three to a
+	 * 32-bit word as put10b_packed() stores them, following the running
+	 * disparity in *state.  Each word is stored once, when it is full or
+	 * at the end, keeping the symbols before index, and the bits after
+	 * the last symbol are zero.  Long runs go six bytes, three pair
+	 * lookups, to two words at a time.
+	 */
+	 void encode_8b10b_packed(uint32_t *buffer, int index, const unsigned char *data,
+			int count, int32_t *state) {
+		uint32_t *out = buffer + index / CHARACTERS_PER_LONGWORD;
+		int position = index % CHARACTERS_PER_LONGWORD;
+		uint32_t acc = position ? *out & ((1u << position * CHARACTER_BITS) - 1) : 0;
+		int rd = *state, k = 0;
+
+		while (k < count) {
+			if (position == 0 && pairMin > 0 && count >= pairMin && count - k >= 6) {
+				encode_pairs_init();
+				for (; count - k >= 6; k += 6, out += 2) {
+					int i0 = data[k] | data[k+1] << 8, i1 = data[k+2] | data[k+3] << 8;
+					int i2 = data[k+4] | data[k+5] << 8;
+					int r1 = rd ^ (Encode_pairs[0][i0] >> 20), r2 = r1 ^ (Encode_pairs[0][i1] >> 20);
+					uint32_t p0 = Encode_pairs[rd][i0];
+					uint32_t p1 = Encode_pairs[r1][i1];
+					uint32_t p2 = Encode_pairs[r2][i2];
+					out[0] = (p0 & 0xfffff) | (p1 & 0x3ff) << 20;
+					out[1] = ((p1 >> 10) & 0x3ff) | (p2 & 0xfffff) << 10;
+					rd = r2 ^ (Encode_pairs[0][i2] >> 20);
+				}
+				continue;
+			}
+			int word = Encode_8b10b[rd][data[k]];
+			rd ^= (Encode_8b10b[0][data[k++]] >> 10) & 1;
+			acc |= (uint32_t)(word & CHARACTER_MASK) << (position * CHARACTER_BITS);
+			if (++position == CHARACTERS_PER_LONGWORD) {
+				*out++ = acc;
+				acc = 0;
+				position = 0;
 			}
 		}
-			
+		if (position)
+			*out = acc;
+		*state = rd;
 	}
-	
+
 	/**
-	 * For test purposes.  Given a chars, return the 10b encoded bits.
-	 * Always the -1 rd parity
-	 * @param word
-	 * @return
+	 * encode_8b10b_packed() for one symbol per uint16_t
 	 */
-	 static int encode(int word) {
-		int word10b = Encode_8b10b[0][word];
-		return word10b;
+	 void encode_8b10b_words(uint16_t *words, const unsigned char *data, int count,
+			int32_t *state) {
+		int rd = *state;
+
+		for (int k=0; k<count; k++) {
+			words[k] = Encode_8b10b[rd][data[k]] & 0x3ff;
+			rd ^= (Encode_8b10b[0][data[k]] >> 10) & 1;
+		}
+		*state = rd;
 	}
 
 	/**
-	 * Returns the Running Disparity to be used for the next call to the encoder given this word
-	 * @param word
-	 * @param flip
-	 * @return
+	 * One step of the running disparity: the flags for the table entry d
+	 * of a received word, given the RD it should have been sent at (-1
+	 * if unknown), which is moved on to the RD after it.  A word that is
+	 * no codeword is erased, and the RD is unknown until the next good
+	 * one; a codeword of the other RD is taken but flagged suspect,
+	 * since it or one of the symbols just before it is wrong.
 	 */
-	 static int getNextRd(int word, int flip) {
-		if (flip) word = ~word & 0x3ff;
-		for (int rd=0; rd<2; rd++)
-			for (int i=0; i<256; i++) {
-				int testValue = Encode_8b10b[rd][i];
-				if ((testValue & 0x3ff) == word) {				
-					int state = (testValue >> 10) & 1;
-					return state;
-				}
+	 static inline int rdStep(int d, int *rd) {
+		int r = *rd, flag = 0;
+
+		if (r < 0)		// either will do
+			r = d & DEC_RD0 ? 0 : 1;
+		else if (!(d & (DEC_RD0 << r))) {
+			r = !r;
+			flag = DECODE_SUSPECT;
+		}
+		if (!(d & (DEC_RD0 << r))) {
+			*rd = -1;
+			return DECODE_ERASED;
+		}
+		*rd = (d & (DEC_NEXT0 << r)) != 0;
+		return flag;
+	}
+
+	/**
+	 * Decode a run of symbols, following the running disparity
+	 */
+	 int decode_symbols(const short int *words, int count, int flip,
+			unsigned char *bytes, unsigned char *flags) {
+		const uint16_t *table = Decode_8b10b[flip != 0];
+		int rd = 0, flagged = 0;	// frames start at RD -1
+
+		decode_init();
+		for (int k=0; k<count; k++) {
+			int d = table[words[k] & 0x3ff];
+			flags[k] = rdStep(d, &rd);
+			bytes[k] = flags[k] & DECODE_ERASED ? 0 : d & DEC_BYTE;
+			if (flags[k])
+				flagged++;
+		}
+		return flagged;
+	}
+
+	 void rd_validator_init(struct rd_validator *v, int flip) {
+		memset(v, 0, sizeof(*v));
+		v->flip = flip != 0;
+		v->frame.first_error = v->file.first_error = -1;
+		decode_init();
+	}
+
+	/**
+	 * Check the next words of a frame against the running disparity,
+	 * counting what decode_symbols() would flag without decoding them
+	 */
+	 int rd_validate(struct rd_validator *v, const short int *words, int count,
+			unsigned char *flags) {
+		const uint16_t *table = Decode_8b10b[v->flip];
+		int errors = 0;
+
+		for (int k=0; k<count; k++) {
+			int flag = rdStep(table[words[k] & 0x3ff], &v->rd);
+			if (flags)
+				flags[k] = flag;
+			if (flag) {
+				if (v->frame.first_error < 0)
+					v->frame.first_error = v->frame.symbols + k;
+				if (flag & DECODE_ERASED)
+					v->frame.invalid++;
+				else
+					v->frame.disparity++;
+				errors++;
 			}
-		return -99; // error state - we did not find the RD sense
-		
-		
-		
-		
+		}
+		v->frame.symbols += count;
+		return errors;
 	}
-	
+
+	 int rd_validator_end_frame(struct rd_validator *v) {
+		struct rd_counts *f = &v->frame, *t = &v->file;
+		int errors = f->invalid + f->disparity;
+
+		if (errors && t->first_error < 0)
+			t->first_error = t->symbols + f->first_error;
+		t->frames++;
+		t->bad_frames += errors != 0;
+		t->symbols += f->symbols;
+		t->invalid += f->invalid;
+		t->disparity += f->disparity;
+		memset(f, 0, sizeof(*f));
+		f->first_error = -1;
+		v->rd = 0;
+		return errors;
+	}
+
 	/**
-	 * Returns the Running Disparity (RD) used to encode the given word by finding it in the look up table
-	 * @param word
-	 * @return
+	 * The positions in a deinterleaved codeword of the symbols carrying
+	 * any of the flags in want, at most NP of them
+	 * @return - the number of such positions
 	 */
-	 static int getRdSense10b(int word, int flip) {
-		if (flip) word = ~word & 0x3ff;
-		for (int rd=0; rd<2; rd++)
-			for (int i=0; i<256; i++) {
-				int testValue = Encode_8b10b[rd][i];
-				if ((testValue & 0x3ff) == word) {				
-					return rd;
+	 static int erasures(const unsigned char *flags, int len, int want, int *eras_pos) {
+		int n = 0;
+
+		for (int k=0; k<len && n<NP; k++)
+			if (flags[k] & want)
+				eras_pos[n++] = k;
+		return n;
+	}
+
+	/**
+	 * The interleaver for a frame layout: the BPSK and DUV ones are built
+	 * by decode_init(), any other in tmp
+	 */
+	 static const struct interleaver *frameLayout(int data_len, int rs_frames,
+			struct interleaver *tmp) {
+		for (int i=0; i<2; i++)
+			if (Frame_layout[i].data_len == data_len && Frame_layout[i].rs_frames == rs_frames)
+				return &Frame_layout[i];
+		return interleaver_init(tmp, data_len, rs_frames) == 0 ? tmp : NULL;
+	}
+
+	 int decode_frame(const short int *words, int data_len, int rs_frames, int flip,
+			int mode, unsigned char *data, struct frame_result *res) {
+		int count = data_len + rs_frames*NP;
+		unsigned char bytes[count], flags[count], cwBytes[count], cwFlags[count];
+		unsigned char cw[DATA_BYTES_PER_CODE_WORD + NP];
+		int eras_pos[NP];
+		int basis = mode & DECODE_DUAL ? RS_DUAL : RS_CONVENTIONAL;
+		struct rs_code code;
+		struct interleaver tmp;
+		const struct interleaver *t;
+
+		mode &= ~DECODE_DUAL;
+		memset(res, 0, sizeof(*res));
+		res->inverted = flip != 0;
+		decode_init();
+		if ((t = frameLayout(data_len, rs_frames, &tmp)) == NULL) {
+			res->failed = rs_frames;
+			return -1;
+		}
+		decode_symbols(words, count, flip, bytes, flags);
+		for (int k=0; k<count; k++) {
+			if (flags[k] & DECODE_ERASED) res->erased++;
+			if (flags[k] & DECODE_SUSPECT) res->suspect++;
+		}
+		deinterleave(t, bytes, cwBytes);
+		deinterleave(t, flags, cwFlags);
+
+		for (int j=0; j<rs_frames; j++) {
+			int len = t->len[j];
+			int want = mode == DECODE_ERRORS_ONLY ? 0 : DECODE_ERASED;
+			unsigned char *cwf = cwFlags + t->start[j];
+			int n = erasures(cwf, len + NP, want, eras_pos);
+			int fixed;
+
+			memcpy(cw, cwBytes + t->start[j], len + NP);
+			fixed = rs_code_init_basis(&code, len, basis) == 0
+				? rs_decode_code(&code, cw, eras_pos, n) : -1;
+			if (fixed < 0 && mode == DECODE_SUSPECTS) {
+				// a wrong RD points at this symbol or one just before;
+				// an erasure costs half an error, so try them all
+				n = erasures(cwf, len + NP, DECODE_ERASED | DECODE_SUSPECT, eras_pos);
+				memcpy(cw, cwBytes + t->start[j], len + NP);
+				fixed = rs_decode_code(&code, cw, eras_pos, n);
+			}
+			if (fixed < 0) {
+				res->failed++;
+				fixed = 0;
+			}
+			res->corrected += fixed;
+			memcpy(cwBytes + t->start[j], cw, len);
+		}
+		interleave(t, cwBytes, bytes);
+		memcpy(data, bytes, data_len);
+		return res->failed ? -1 : 0;
+	}
+
+	/**
+	 * Find every start of a len-bit pattern, or of its complement, in a
+	 * bit stream, 64 start positions at a time.  Bit j of the windows at
+	 * the 64 starts in a word is one shifted copy of the stream, so the
+	 * starts that match are the AND over j of that copy, inverted where
+	 * the pattern has a 0; the complement is the same with the other
+	 * sense.  Random data clears both masks within a few bits, so the
+	 * loop stops as soon as they are empty.
+	 */
+	 long find_sync(const uint64_t *bits, long nbits, uint64_t pattern, int len,
+			long *pos, unsigned char *inverted, long max) {
+		uint64_t sense[64];
+		long words = (nbits + 63) / 64, found = 0;
+
+		if (len < 1 || len > 64 || nbits < len)
+			return 0;
+		for (int j=0; j<len; j++)
+			sense[j] = (pattern >> (len - 1 - j) & 1) ? 0 : ~0ULL;
+
+		for (long i=0; i*64 <= nbits - len; i++) {
+			uint64_t w0 = bits[i], w1 = i + 1 < words ? bits[i+1] : 0;
+			uint64_t same = ~0ULL, other = ~0ULL;
+			long last = nbits - len - i*64;		// last start in the stream
+
+			if (last < 63)
+				same = other = ~0ULL << (63 - last);
+			for (int j=0; j<len && (same | other); j++) {
+				uint64_t s = (j ? w0 << j | w1 >> (64 - j) : w0) ^ sense[j];
+				same &= s;
+				other &= ~s;
+			}
+			for (uint64_t any = same | other; any; found++) {
+				int b = __builtin_clzll(any);	// first bit first
+				any &= ~0ULL >> b >> 1;
+				if (found < max) {
+					pos[found] = i*64 + b;
+					if (inverted)
+						inverted[found] = (other >> (63 - b)) & 1;
 				}
 			}
-		return -99; // error state - we did not find the RD sense
+		}
+		return found;
+	}
+
+	 long find_commas(const uint64_t *bits, long nbits, long *pos,
+			unsigned char *inverted, long max) {
+		return find_sync(bits, nbits, NOT_FRAME, 10, pos, inverted, max);
+	}
+
+	/**
+	 * The len bits (len <= 64) from bit pos of a stream on, the first in
+	 * the most significant place
+	 */
+	 static uint64_t getBits(const uint64_t *bits, long nbits, long pos, int len) {
+		long i = pos >> 6;
+		int off = pos & 63;
+		uint64_t w = bits[i] << off;
+
+		if (off && (i + 1) * 64 < nbits)
+			w |= bits[i+1] >> (64 - off);
+		return w >> (64 - len);
+	}
+
+	/**
+	 * Correlate the stream at pos with the pattern: the bits that agree
+	 * less the bits that differ.  The sign gives the polarity of the
+	 * frame, and stays right with up to half the sync bits wrong.
+	 */
+	 int sync_correlation(const uint64_t *bits, long nbits, long pos, uint64_t pattern, int len) {
+		uint64_t mask = len < 64 ? (1ULL << len) - 1 : ~0ULL;
+
+		if (len < 1 || len > 64 || pos < 0 || pos + len > nbits)
+			return 0;
+		return len - 2 * __builtin_popcountll((getBits(bits, nbits, pos, len) ^ pattern) & mask);
+	}
+
+	/**
+	 * Decode the frame whose sync word starts at bit pos: the polarity is
+	 * settled once from the sync word, then every symbol is looked up in
+	 * the table for it
+	 */
+	 int decode_frame_bits(const uint64_t *bits, long nbits, long pos, uint64_t sync,
+			int sync_bits, int data_len, int rs_frames, int mode, unsigned char *data,
+			struct frame_result *res) {
+		int count = data_len + rs_frames*NP;
+		short int words[count];
+		long start = pos + sync_bits;
+
+		if (pos < 0 || start + 10L*count > nbits) {
+			memset(res, 0, sizeof(*res));
+			res->failed = rs_frames;
+			return -1;
+		}
+		for (int k=0; k<count; k++)
+			words[k] = getBits(bits, nbits, start + 10L*k, 10);
+		return decode_frame(words, data_len, rs_frames,
+			sync_correlation(bits, nbits, pos, sync, sync_bits) < 0, mode, data, res);
 	}
-	
-//}
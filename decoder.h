@@ -0,0 +1,110 @@
+/* decoder.h
+ * Receive side of the Fox-1 telemetry coding: 8b10b decoding that keeps
+ * track of which symbols could not be trusted, and Reed-Solomon decoding
+ * of whole frames that uses them as erasures.
+ */
+
+#ifndef DECODER_H
+#define DECODER_H
+
+#include <stdint.h>
+
+void decode_init(void);
+    /* build the inverse 8b10b tables; called on first use, but call it
+       up front before decoding from several threads */
+
+/* Per symbol flags from decode_symbols() */
+#define DECODE_ERASED	1	/* not an 8b10b codeword at all */
+#define DECODE_SUSPECT	2	/* a codeword, but for the other running disparity */
+
+int decode_symbols(const short int *words, int count, int flip,
+	unsigned char *bytes, unsigned char *flags);
+    /* decode count 10-bit words (inverted first if flip), starting with
+       RD -1 as every frame does; returns how many were flagged */
+
+/* Running disparity check of a received stream, without decoding it */
+struct rd_counts {
+	long frames;		/* frames ended (file counts only) */
+	long bad_frames;	/* of those, frames with any error */
+	long symbols;
+	long invalid;		/* not 8b10b codewords */
+	long disparity;		/* codewords for the other running disparity */
+	long first_error;	/* symbol index of the first error, -1 if none */
+};
+
+struct rd_validator {
+	int flip;		/* words are inverted */
+	int rd;			/* of the next word: 0 for -1, 1 for +1, -1 unknown */
+	struct rd_counts frame;	/* this frame so far */
+	struct rd_counts file;	/* every frame ended */
+};
+
+void rd_validator_init(struct rd_validator *v, int flip);
+    /* zero the counts and start the first frame at RD -1 */
+
+int rd_validate(struct rd_validator *v, const short int *words, int count,
+	unsigned char *flags);
+    /* check the next count words of the frame, any number at a time;
+       fills flags[] as decode_symbols() does if it is not NULL, and
+       returns how many were flagged */
+
+int rd_validator_end_frame(struct rd_validator *v);
+    /* add the frame to the file counts and start the next one at RD -1;
+       returns the errors in the frame just ended */
+
+/* How decode_frame() uses the flags */
+#define DECODE_ERRORS_ONLY	0	/* ignore them */
+#define DECODE_ERASURES		1	/* erase invalid symbols */
+#define DECODE_SUSPECTS		2	/* and if that fails, suspect ones too */
+#define DECODE_DUAL		4	/* or'ed in: RS symbols in the CCSDS dual basis */
+
+/* What decode_frame() found in one frame */
+struct frame_result {
+	int erased;	/* symbols that were not 8b10b codewords */
+	int suspect;	/* codewords received with the wrong running disparity */
+	int corrected;	/* bytes fixed by Reed-Solomon */
+	int failed;	/* codewords beyond repair */
+	int inverted;	/* decoded with the phase inverted */
+};
+
+int decode_frame(const short int *words, int data_len, int rs_frames, int flip,
+	int mode, unsigned char *data, struct frame_result *res);
+    /* decode the data_len + 32 * rs_frames symbols following the sync word
+       of one frame: data_len bytes striped over rs_frames codewords (476
+       over 3 for BPSK, 64 over 1 for DUV), then their interleaved parities.
+       Writes the corrected data bytes; returns 0, or -1 if any codeword
+       could not be corrected. */
+
+/* Frame sync words, sent most significant bit first */
+#define SYNC_BPSK	0x47cd215dL	/* 31 bits */
+#define SYNC_BPSK_BITS	31
+#define SYNC_DUV	0x0fa		/* K.28.5 at RD -1 */
+#define SYNC_DUV_BITS	10
+
+long find_sync(const uint64_t *bits, long nbits, uint64_t pattern, int len,
+	long *pos, unsigned char *inverted, long max);
+    /* find every start of the len-bit pattern (len <= 64) or of its
+       complement in nbits bits, bit 0 being the most significant bit of
+       bits[0]; stores the first max starts in pos[] in order, and in
+       inverted[] (if not NULL) 1 where the complement matched.  Returns
+       how many there are. */
+
+long find_commas(const uint64_t *bits, long nbits, long *pos,
+	unsigned char *inverted, long max);
+    /* find_sync() for K.28.5: inverted is 1 for the RD +1 form, or the
+       RD -1 form received with the phase inverted */
+
+int sync_correlation(const uint64_t *bits, long nbits, long pos, uint64_t pattern, int len);
+    /* the len bits at bit pos that match the pattern less those that do
+       not: positive when the frame there is received as sent, negative
+       when it is inverted */
+
+int decode_frame_bits(const uint64_t *bits, long nbits, long pos, uint64_t sync,
+	int sync_bits, int data_len, int rs_frames, int mode, unsigned char *data,
+	struct frame_result *res);
+    /* decode_frame() on the frame whose sync_bits bit sync word starts at
+       bit pos of the stream, as find_sync() reports it.  The polarity
+       comes from the sign of sync_correlation() there, once for the whole
+       frame.  Returns -1 as well if the frame runs past nbits. */
+
+#endif /* DECODER_H */
@@ -0,0 +1,47 @@
+/* interleave.c
+ * Frame striping over Reed-Solomon codewords, see interleave.h
+ */
+
+#include <string.h>
+
+#include "make_wav.h"
+#include "interleave.h"
+
+int interleaver_init(struct interleaver *t, int data_len, int rs_frames)
+{
+	int n = 0;
+
+	if (rs_frames < 1 || rs_frames > INTERLEAVE_MAX_FRAMES || data_len < 0
+		|| data_len > rs_frames * DATA_BYTES_PER_CODE_WORD)
+		return -1;
+	memset(t, 0, sizeof(*t));
+	t->data_len = data_len;
+	t->rs_frames = rs_frames;
+	t->count = data_len + rs_frames * NP;
+
+	for (int j = 0; j < rs_frames; j++) {
+		t->len[j] = (data_len - j + rs_frames - 1) / rs_frames;
+		t->start[j] = n;
+		for (int k = j; k < data_len; k += rs_frames)
+			t->to_frame[n++] = k;
+		for (int i = 0; i < NP; i++)
+			t->to_frame[n++] = data_len + i * rs_frames + j;
+	}
+	for (int k = 0; k < t->count; k++)
+		t->to_codeword[t->to_frame[k]] = k;
+	return 0;
+}
+
+void interleave(const struct interleaver *t, const unsigned char *codewords,
+	unsigned char *frame)
+{
+	for (int k = 0; k < t->count; k++)
+		frame[k] = codewords[t->to_codeword[k]];
+}
+
+void deinterleave(const struct interleaver *t, const unsigned char *frame,
+	unsigned char *codewords)
+{
+	for (int k = 0; k < t->count; k++)
+		codewords[k] = frame[t->to_frame[k]];
+}
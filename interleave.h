@@ -0,0 +1,44 @@
+/* interleave.h
+ * Striping of a frame over its Reed-Solomon codewords.  The data bytes
+ * of a frame go to the codewords in turn, byte k to codeword k % rs_frames,
+ * so with 476 bytes over 3 the last codeword is one byte short; the 32
+ * parities of every codeword follow, interleaved the same way.
+ *
+ * The permutation is worked out once for a frame layout and kept both
+ * ways, so either direction is one gather pass over the frame.
+ */
+
+#ifndef INTERLEAVE_H
+#define INTERLEAVE_H
+
+#include <stdint.h>
+
+#define INTERLEAVE_MAX_FRAMES	4	/* codewords in a frame */
+#define INTERLEAVE_MAX		(INTERLEAVE_MAX_FRAMES * 255)
+
+struct interleaver {
+	int data_len;		/* data bytes in the frame */
+	int rs_frames;		/* codewords they are striped over */
+	int count;		/* bytes in the frame, data_len + 32 * rs_frames */
+	int len[INTERLEAVE_MAX_FRAMES];		/* data bytes in each codeword */
+	int start[INTERLEAVE_MAX_FRAMES];	/* where each codeword starts */
+	uint16_t to_frame[INTERLEAVE_MAX];	/* frame byte of each codeword byte */
+	uint16_t to_codeword[INTERLEAVE_MAX];	/* codeword byte of each frame byte */
+};
+
+int interleaver_init(struct interleaver *t, int data_len, int rs_frames);
+    /* work out the permutation for data_len bytes over rs_frames
+       codewords of at most 223 data bytes each; returns 0, or -1 if the
+       layout does not fit */
+
+void interleave(const struct interleaver *t, const unsigned char *codewords,
+	unsigned char *frame);
+    /* the frame, in the order it is sent, from the codewords one after
+       another: codeword j at codewords + start[j], its len[j] data bytes
+       then its 32 parities */
+
+void deinterleave(const struct interleaver *t, const unsigned char *frame,
+	unsigned char *codewords);
+    /* the other way */
+
+#endif /* INTERLEAVE_H */
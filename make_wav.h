@@ -4,13 +4,57 @@
  
 #ifndef MAKE_WAV_H
 #define MAKE_WAV_H
+
+#include <stdio.h>
+#include <stdint.h>
  
 void write_wav(char * filename, unsigned long num_samples, short int * data, int s_rate);
     /* open a file named filename, write signed 16-bit values as a
         monoaural WAV file at the specified sampling rate
         and close the file
     */
- 
+
+/* Sample formats understood by write_wav_format() */
+#define WAV_S16 0	/* signed 16-bit PCM (what write_wav() produces) */
+#define WAV_U8  1	/* unsigned 8-bit PCM */
+#define WAV_F32 2	/* 32-bit IEEE float */
+
+void write_wav_format(char * filename, unsigned long num_samples, short int * data, int s_rate, int format);
+    /* same as write_wav(), converting the 16-bit samples to format */
+
+int wav_bytes_per_sample(int format);
+
+/* Streaming WAV output, for files too big to hold in memory */
+struct wav_writer {
+	FILE *file;
+	int format;
+	int rate;
+	unsigned long samples;
+};
+
+int wav_writer_open(struct wav_writer *w, char *filename, int s_rate, int format);
+void wav_writer_write(struct wav_writer *w, const short int *data, unsigned long num_samples);
+int wav_writer_close(struct wav_writer *w);
+    /* fills in the sizes in the header and closes the file */
+
+/* Streaming WAV input of the mono files written above */
+struct wav_reader {
+	FILE *file;
+	int format;
+	int rate;
+	int channels;
+	unsigned long samples;		/* in the data chunk */
+	unsigned long remaining;	/* not read yet */
+};
+
+int wav_reader_open(struct wav_reader *r, char *filename);
+    /* returns 0, or -1 if the file is missing or not a mono
+       s16 / u8 / f32 WAV file */
+long wav_reader_read(struct wav_reader *r, short int *data, long num_samples);
+    /* read up to num_samples, converted to signed 16 bits;
+       returns how many were read, 0 at the end of the data */
+void wav_reader_close(struct wav_reader *r);
+
 #endif
 
 /*
@@ -32,27 +76,77 @@ int encode_8b10b(
     int32_t *state, // pointer to encoder state (run disparity, RD)
     int32_t data);
 
+void encode_8b10b_packed(
+    uint32_t *buffer,          // 3 symbols per word, as Put10bInBuffer() stores them
+    int index,                 // first symbol to write
+    const unsigned char *data, // count bytes to encode
+    int count,
+    int32_t *state);           // run disparity, updated
+
+void encode_8b10b_words(
+    uint16_t *words,           // one symbol each
+    const unsigned char *data, // count bytes to encode
+    int count,
+    int32_t *state);           // run disparity, updated
+
+#define ENCODE_PAIR_MIN (1 << 18)
+int encode_8b10b_select(int min_bytes);
+    /* encode_8b10b_packed() takes runs of at least min_bytes bytes two
+       at a time through a 512 KB table, shorter ones a byte at a time;
+       -1 never uses the big table, 0 keeps the setting.  The default,
+       ENCODE_PAIR_MIN, is about where bench_encode finds it pays off
+       from a cold cache.
+       Returns the setting now in use. */
+
 #define CHARACTER_BITS 10
 #define CHARACTERS_PER_LONGWORD 3
 #define CHARACTER_MASK ((1<<CHARACTER_BITS)-1)
+#define LONGWORDS(n) (((n)+CHARACTERS_PER_LONGWORD-1)/CHARACTERS_PER_LONGWORD) /* words for n characters */
 #define SYNC_CHARACTER -1
 
-extern int maxNewBuffer,maxOldBuffer;
-#if 1
-static void inline Put10bInBuffer(
+/*
+ * The packed layout, whatever PACK_10B says: 3 10-bit data items (we'll
+ * call them characters) to each 32-bit word, the first in the low bits,
+ * with two bits left over at the most significant end.  pack_10b(),
+ * struct symbols and the packed encoders always use it.
+ */
+static void inline put10b_packed(
 		uint32_t *bufferBase,
 		int index,
 		uint16_t data)
 {
-	/*
-	 * We are going to put 3 10-bit data items (we'll call them characters) into each
-	 * 32-bit word in the buffer with
-	 * two bits left over at the most significant end.
-	 */
 	int bufferIndex = index/CHARACTERS_PER_LONGWORD; /* Which 32-bit word?*/
 	int position = (index%CHARACTERS_PER_LONGWORD)*CHARACTER_BITS;    /* Which position within the 32 bits? */
 	if(position == 0)bufferBase[bufferIndex] = 0; /* Initialize the 3-character buffer */
 	bufferBase[bufferIndex] |= data << position;
+}
+
+static uint16_t inline get10b_packed(
+		const uint32_t *bufferBase,
+		int index)
+{
+	int bufferIndex = index/CHARACTERS_PER_LONGWORD; /* Which 32-bit word?*/
+	int position = (index%CHARACTERS_PER_LONGWORD)*CHARACTER_BITS;    /* Which position within the 32 bits? */
+	return (bufferBase[bufferIndex]>>position) & CHARACTER_MASK;
+}
+
+/* Put10bInBuffer() layout, for the callers that predate struct symbols:
+   1 packs three characters to a 32-bit word as put10b_packed(), 0 keeps
+   one to a uint16_t.  Build with -DPACK_10B=0 to change it; struct
+   symbols in symbols.h picks either at run time */
+#ifndef PACK_10B
+#define PACK_10B 1
+#endif
+
+extern int maxNewBuffer,maxOldBuffer;
+#if PACK_10B
+static void inline Put10bInBuffer(
+		uint32_t *bufferBase,
+		int index,
+		uint16_t data)
+{
+	int bufferIndex = index/CHARACTERS_PER_LONGWORD; /* Which 32-bit word?*/
+	put10b_packed(bufferBase, index, data);
 	if(bufferIndex > maxNewBuffer)maxNewBuffer = bufferIndex;
 	if(index > maxOldBuffer)maxOldBuffer = index;
 }
@@ -61,12 +155,7 @@ static uint16_t inline Get10bFromBuffer(
 		uint32_t *bufferBase,
 		int index)
 {
-	int bufferIndex = index/CHARACTERS_PER_LONGWORD; /* Which 32-bit word?*/
-	int position = (index%CHARACTERS_PER_LONGWORD)*CHARACTER_BITS;    /* Which position within the 32 bits? */
-	uint16_t retChar;
-	retChar = (bufferBase[bufferIndex]>>position) & CHARACTER_MASK;
-	return retChar;
-
+	return get10b_packed(bufferBase, index);
 }
 #else
 static void inline Put10bInBuffer(
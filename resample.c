@@ -0,0 +1,241 @@
+/* resample.c
+ * Rational L/M polyphase sample rate conversion, see resample.h
+ *
+ * The prototype low pass is a Kaiser windowed sinc of L * taps
+ * coefficients, split into L branches.  Output sample m sits at position
+ * u = m * M + delay of the signal interpolated by L; only branch u % L
+ * lines up with real input samples, so each output is one taps long dot
+ * product over contiguous input.
+ *
+ * The dot product keeps 8 partial sums whatever the instruction set, and
+ * adds them up in the same order, so the scalar, SSE and AVX kernels give
+ * bit-identical results.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#include "resample.h"
+
+static long gcd(long a, long b)
+{
+	while (b) {
+		long t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+// Modified Bessel function of the first kind, order 0, for the Kaiser window
+static double bessel_i0(double x)
+{
+	double sum = 1, term = 1;
+
+	for (int k = 1; k < 50 && term > 1e-12 * sum; k++) {
+		term *= (x / (2 * k)) * (x / (2 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+static inline float sum8(const float acc[8])
+{
+	return ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+}
+
+static float dot_c(const float *a, const float *b, int n)
+{
+	float acc[8] = { 0 };
+
+	for (int i = 0; i < n; i += 8)
+		for (int k = 0; k < 8; k++)
+			acc[k] += a[i + k] * b[i + k];
+	return sum8(acc);
+}
+
+#ifdef HAVE_X86
+__attribute__((target("sse")))
+static float dot_sse(const float *a, const float *b, int n)
+{
+	__m128 lo = _mm_setzero_ps(), hi = _mm_setzero_ps();
+	float acc[8];
+
+	for (int i = 0; i < n; i += 8) {
+		lo = _mm_add_ps(lo, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		hi = _mm_add_ps(hi, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+	}
+	_mm_storeu_ps(acc, lo);
+	_mm_storeu_ps(acc + 4, hi);
+	return sum8(acc);
+}
+
+__attribute__((target("avx")))
+static float dot_avx(const float *a, const float *b, int n)
+{
+	__m256 sum = _mm256_setzero_ps();
+	float acc[8];
+
+	for (int i = 0; i < n; i += 8)
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+	_mm256_storeu_ps(acc, sum);
+	return sum8(acc);
+}
+#endif
+
+static float (*dot)(const float *, const float *, int);
+
+static void pick_kernel(void)
+{
+	dot = dot_c;
+#ifdef HAVE_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx"))
+		dot = dot_avx;
+	else if (__builtin_cpu_supports("sse"))
+		dot = dot_sse;
+#endif
+}
+
+int resample_init(struct resampler *r, int in_rate, int out_rate, int quality)
+{
+	long g, n;
+	double fc, beta, sum = 0, *h;
+
+	memset(r, 0, sizeof(*r));
+	if (in_rate <= 0 || out_rate <= 0)
+		return -1;
+	if (dot == NULL)
+		pick_kernel();
+	if (quality < 1) quality = 1;
+	if (quality > 32) quality = 32;
+
+	g = gcd(in_rate, out_rate);
+	r->L = out_rate / g;
+	r->M = in_rate / g;
+	// when decimating the filter has to span M / L times as many input
+	// samples for the same transition width at the output
+	r->taps = 8 * quality * (r->M > r->L ? (r->M + r->L - 1) / r->L : 1);
+	n = (long)r->L * r->taps;
+
+	// cut off at 90% of the lower Nyquist frequency; longer filters get a
+	// larger Kaiser beta for more stop band rejection
+	fc = 0.45 / (r->L > r->M ? r->L : r->M);
+	beta = 4 + 1.15 * quality;
+	if (beta > 12) beta = 12;
+
+	h = malloc(n * sizeof(double));
+	r->coef = malloc(n * sizeof(float));
+	r->hist = malloc((r->taps - 1 + RESAMPLE_BLOCK) * sizeof(float));
+	if (h == NULL || r->coef == NULL || r->hist == NULL) {
+		free(h);
+		resample_free(r);
+		return -1;
+	}
+	// centred on sample n / 2 so the delay is a whole number of samples
+	for (long k = 0; k < n; k++) {
+		double x = k - n / 2;
+		double w = x / (n / 2);
+		h[k] = (x == 0 ? 2 * fc : sin(2 * M_PI * fc * x) / (M_PI * x))
+			* bessel_i0(beta * sqrt(1 - w * w)) / bessel_i0(beta);
+		sum += h[k];
+	}
+	// unity gain at DC through every branch, branch coefficients reversed
+	for (int p = 0; p < r->L; p++)
+		for (int t = 0; t < r->taps; t++)
+			r->coef[p * r->taps + t] = h[p + (long)r->L * (r->taps - 1 - t)] * r->L / sum;
+	free(h);
+
+	memset(r->hist, 0, (r->taps - 1) * sizeof(float));
+	r->hist_len = r->taps - 1;
+	r->hist_base = -(r->taps - 1);
+	r->next_u = n / 2;	// filter delay
+	return 0;
+}
+
+void resample_free(struct resampler *r)
+{
+	free(r->coef);
+	free(r->hist);
+	r->coef = r->hist = NULL;
+}
+
+long resample_max_out(struct resampler *r, long n)
+{
+	return (n + r->taps) * r->L / r->M + 2;
+}
+
+// Produce every output the buffered input allows, up to limit in total
+static long produce(struct resampler *r, short int *out, long limit)
+{
+	long done = 0, keep;
+
+	while (r->out_total < limit) {
+		long n0 = r->next_u / r->L;
+		if (n0 >= r->hist_base + r->hist_len)
+			break;
+		float y = dot(r->coef + (r->next_u % r->L) * r->taps,
+			r->hist + (n0 - r->taps + 1 - r->hist_base), r->taps);
+		y = y >= 0 ? y + 0.5f : y - 0.5f;
+		out[done++] = y >= 32767 ? 32767 : y <= -32768 ? -32768 : (short int)y;
+		r->next_u += r->M;
+		r->out_total++;
+	}
+
+	// drop the input no later output reaches
+	keep = r->next_u / r->L - r->taps + 1 - r->hist_base;
+	if (keep > r->hist_len)
+		keep = r->hist_len;
+	if (keep > 0) {
+		memmove(r->hist, r->hist + keep, (r->hist_len - keep) * sizeof(float));
+		r->hist_len -= keep;
+		r->hist_base += keep;
+	}
+	return done;
+}
+
+// Append up to the free space in hist[] from in (zeros if in is NULL)
+static long append(struct resampler *r, const short int *in, long n)
+{
+	long room = r->taps - 1 + RESAMPLE_BLOCK - r->hist_len;
+
+	if (n > room)
+		n = room;
+	for (long i = 0; i < n; i++)
+		r->hist[r->hist_len + i] = in ? in[i] : 0;
+	r->hist_len += n;
+	return n;
+}
+
+long resample_process(struct resampler *r, const short int *in, long n, short int *out)
+{
+	long done = 0;
+
+	while (n > 0) {
+		long k = append(r, in, n);
+		in += k;
+		n -= k;
+		r->in_total += k;
+		done += produce(r, out + done, LONG_MAX);
+	}
+	return done;
+}
+
+long resample_flush(struct resampler *r, short int *out)
+{
+	long target = (r->in_total * r->L + r->M - 1) / r->M;
+	long done = 0;
+
+	while (r->out_total < target) {
+		append(r, NULL, RESAMPLE_BLOCK);
+		done += produce(r, out + done, target);
+	}
+	return done;
+}
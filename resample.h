@@ -0,0 +1,44 @@
+/* resample.h
+ * Rational L/M polyphase sample rate conversion of 16-bit audio.
+ *
+ * Streams: feed any number of samples at a time with resample_process(),
+ * then resample_flush() for the tail, and the output is the same as one
+ * call over the whole file.  The output is aligned with the input (the
+ * filter delay is compensated) and has ceil(n * L / M) samples.
+ */
+
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#define RESAMPLE_QUALITY 4	// default; taps per phase = 8 * quality * ceil(M / L)
+#define RESAMPLE_BLOCK 4096	// input samples filtered per pass
+
+struct resampler {
+	int L, M;		// interpolate by L, decimate by M (reduced)
+	int taps;		// per polyphase branch, a multiple of 8
+	float *coef;		// L branches of taps, each stored time reversed
+	float *hist;		// input: taps - 1 old samples then new ones
+	long hist_len;		// samples in hist[]
+	long hist_base;		// input index of hist[0]
+	long next_u;		// next output's position at the interpolated rate
+	long in_total;		// input samples fed so far
+	long out_total;		// output samples produced so far
+};
+
+int resample_init(struct resampler *r, int in_rate, int out_rate, int quality);
+    /* quality 1..32 trades speed for stop band rejection and a sharper
+       cutoff; returns 0, or -1 on bad rates or no memory */
+
+long resample_max_out(struct resampler *r, long n);
+    /* most samples resample_process() can return for n input samples */
+
+long resample_process(struct resampler *r, const short int *in, long n, short int *out);
+    /* filter n more input samples; returns how many were written to out */
+
+long resample_flush(struct resampler *r, short int *out);
+    /* write the remaining output, at most resample_max_out(r, taps)
+       samples; returns how many */
+
+void resample_free(struct resampler *r);
+
+#endif /* RESAMPLE_H */
@@ -0,0 +1,85 @@
+/* resample_wav.c
+ * Convert a mono WAV file (as written by make_wav) to another sample rate
+ * with the polyphase resampler, a block at a time so files of any length
+ * stream through in constant memory.
+ *
+ * gcc -O2 -o resample_wav resample_wav.c resample.c wav.c -lm
+ * ./resample_wav [-q quality] [-f s16|u8|f32] in.wav out.wav rate
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "make_wav.h"
+#include "resample.h"
+
+static void usage(char *prog)
+{
+	fprintf(stderr, "usage: %s [-q quality] [-f s16|u8|f32] in.wav out.wav rate\n"
+		"  -q  1 (fast) to 32 (sharpest filter), default %d\n"
+		"  -f  output sample format, default the input's\n",
+		prog, RESAMPLE_QUALITY);
+	exit(1);
+}
+
+int main(int argc, char * argv[])
+{
+	static const char *format_names[] = { "s16", "u8", "f32" };
+	struct wav_reader in;
+	struct wav_writer out;
+	struct resampler r;
+	int quality = RESAMPLE_QUALITY, format = -1, rate;
+	short int inbuf[RESAMPLE_BLOCK], *outbuf;
+	long n;
+	int a;
+
+	for (a = 1; a < argc && argv[a][0] == '-'; a++)
+	{
+		if (strcmp(argv[a], "-q") == 0 && a + 1 < argc)
+			quality = atoi(argv[++a]);
+		else if (strcmp(argv[a], "-f") == 0 && a + 1 < argc)
+		{
+			a++;
+			for (format = 0; format < 3; format++)
+				if (strcmp(argv[a], format_names[format]) == 0)
+					break;
+			if (format == 3)
+				usage(argv[0]);
+		}
+		else
+			usage(argv[0]);
+	}
+	if (argc - a != 3 || (rate = atoi(argv[a + 2])) <= 0)
+		usage(argv[0]);
+
+	if (wav_reader_open(&in, argv[a]) != 0)
+	{
+		fprintf(stderr, "%s: not a mono 8/16-bit PCM or float WAV file\n", argv[a]);
+		return 1;
+	}
+	if (format < 0)
+		format = in.format;
+	if (resample_init(&r, in.rate, rate, quality) != 0
+		|| (outbuf = malloc(resample_max_out(&r, RESAMPLE_BLOCK) * sizeof(short int))) == NULL)
+	{
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+	if (wav_writer_open(&out, argv[a + 1], rate, format) != 0)
+	{
+		fprintf(stderr, "Cannot create %s\n", argv[a + 1]);
+		return 1;
+	}
+
+	while ((n = wav_reader_read(&in, inbuf, RESAMPLE_BLOCK)) > 0)
+		wav_writer_write(&out, outbuf, resample_process(&r, inbuf, n, outbuf));
+	wav_writer_write(&out, outbuf, resample_flush(&r, outbuf));
+
+	printf("%s: %lu samples at %d Hz -> %s: %lu samples at %d Hz (L/M = %d/%d, %d taps per phase)\n",
+		argv[a], in.samples, in.rate, argv[a + 1], out.samples, rate, r.L, r.M, r.taps);
+	wav_reader_close(&in);
+	resample_free(&r);
+	free(outbuf);
+	return wav_writer_close(&out) == 0 ? 0 : 1;
+}
@@ -0,0 +1,902 @@
+/* rs.c
+ * CCSDS Reed-Solomon (255,223) encoding, split out of make_wav.c.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#include "make_wav.h"
+#include "rs.h"
+
+/*
+ * TelemEncoding.c
+ *
+   Fox-1 telemetry encoder
+   January 2014 Phil Karn KA9Q
+
+   This file has two external functions:
+      void update_rs(unsigned char parity[32],unsigned char data);
+      int encode_8b10b(int *state,int data).
+
+   update_rs() is the Reed-Solomon encoder. Its first argument is the 32-byte
+   encoder shift register, the second is the 8-bit data byte being encoded. It updates
+   the shift register in place and returns void. At the end of each frame, it contains
+   the parities ready for transmission, starting with parity[0].
+   Be sure to zero this array before each new frame!
+
+   encode_8b10b() is the 8b10b encoder. Its first argument is a pointer to a single integer
+   with the 1-bit encoder state (the current run disparity, or RD). Initialize it to 0
+   JUST ONCE at startup (not between frames).
+   The second argument is the data byte being encoded. It updates the state and returns
+   an integer containing the 10-bit encoded word, right justified.
+   Transmit this word from left to right.
+
+   The data argument is an int so it can hold the special value -1 to indicate end of frame;
+   it generates the 8b10b control word K.28.5, which is used as an inter-frame flag.
+
+   Some assert() calls are made to verify legality of arguments. These can be turned off in
+   production code.
+
+
+   sample frame transmission code:
+
+   unsigned char data[64]; // Data block to be sent
+   unsigned char parity[32]; // RS parities
+   void transmit_word(int);  // User provided transmit function: 10 bits of data in bits 9....0
+   int state,i;
+
+   state = 0; // Only once at startup, not between frames
+   memset(parity,0,sizeof(parity); // Do this before every frame
+   // Transmit the data, updating the RS encoder
+   for(i=0;i<64;i++){
+     update_rs(parity,data[i]);
+     transmit_word(encode_8b10b(&state,data[i]);
+   }
+   // Transmit the RS parities
+   for(i=0;i<32;i++)
+     transmit_word(encode_8b10b(&state,parity[i]);
+
+   transmit_word(encode_8b10b(&state,-1); // Transmit end-of-frame flag
+*/
+
+
+#include <string.h>
+//#include "Fox.h"
+//#include "TelemEncoding.h"
+
+#ifndef NULL
+#define NULL ((void *)0)
+#endif
+
+#include "rs_ccsds.h"		// the tables, generated by rs_gen
+
+#define NN CCSDS_NN // Frame size in symbols
+#define A0 (NN)   // special value for log(0)
+#define FCR CCSDS_FCR   // first consecutive root of the generator, index form
+#define PRIM CCSDS_PRIM // spacing of the roots, alpha^11 apart
+
+// The generator polynomial is palindromic, G0 = G32, G1 = G31, etc.,
+// so update_rs() only looks at CCSDS_poly[0..16]; only G16 is unique
+
+static inline int modnn(int x){
+  while (x >= NN) {
+    x -= NN;
+    x = (x >> 8) + (x & NN);
+  }
+  return x;
+}
+
+
+// Update Reed-Solomon encoder
+// parity -> 32-byte reed-solomon encoder state; clear this to zero before each frame
+void update_rs(
+   unsigned char parity[32], // 32-byte encoder state; zero before each frame
+   unsigned char c)          // Current data byte to update
+{
+  unsigned char feedback;
+  int j,t;
+
+  assert(parity != NULL);
+  feedback = CCSDS_index_of[c ^ parity[0]];
+  if(feedback != A0){ // only if feedback is non-zero
+    // Take advantage of palindromic polynomial to halve the multiplies
+    // Do G1...G15, which is the same as G17...G31
+    for(j=1;j<NP/2;j++){
+      t = CCSDS_alpha_to[modnn(feedback + CCSDS_poly[j])];
+      parity[j] ^= t;
+      parity[NP-j] ^= t;
+    }
+    // Do G16, which is used in only parity[16]
+    t = CCSDS_alpha_to[modnn(feedback + CCSDS_poly[j])];
+    parity[j] ^= t;
+  }
+  // shift left
+  memmove(&parity[0],&parity[1],NP-1);
+  // G0 is 1 in alpha form, 0 in index form; don't need to multiply by it
+  parity[NP-1] = CCSDS_alpha_to[feedback];
+  //taskYIELD();
+}
+
+/* rs_table[x][k] is what the byte x at the head of the register (data
+   byte XOR parity[0]) contributes to parity[k] after the shift: x times
+   generator coefficient G(k+1), with G32 = G0 = 1 going into the last
+   byte.  It is the whole body of update_rs() for one feedback value.
+   Each row is stored twice over so struct rs_encoder can XOR it into its
+   rotated register from any starting point in one pass. */
+static unsigned char rs_table[NN+1][2*NP];
+static int rs_ready;
+
+/* The same products split by nibble for PSHUFB: x * G = lo[x & 15] ^
+   hi[x >> 4], a 16-entry table lookup each */
+static unsigned char rs_nibble[NP][2][16] __attribute__((aligned(16)));
+
+/* CCSDS dual basis: rs_taltab[] maps a conventional byte to the dual
+   basis, rs_tal1tab[] back.  Both are linear over GF(2), so a product
+   by a constant can be tabulated straight from dual to dual, and an
+   encoder register kept in the dual basis runs off rs_table_dual[x] =
+   rs_taltab[rs_table[rs_tal1tab[x]]] exactly as it would off rs_table[],
+   with no pass over the data or the parities to convert them.  The
+   syndrome kernels look up rs_tal1nib[], rs_tal1tab[] split by nibble,
+   on each block as they load it. */
+static const unsigned char rs_tal[8] = { 0x8d, 0xef, 0xec, 0x86, 0xfa, 0x99, 0xaf, 0x7b };
+static unsigned char rs_taltab[NN+1], rs_tal1tab[NN+1];
+static unsigned char rs_table_dual[NN+1][2*NP];
+static unsigned char rs_nibble_dual[NP][2][16] __attribute__((aligned(16)));
+static unsigned char rs_tal1nib[2][16] __attribute__((aligned(16)));
+static uint64_t rs_tal1mask[8][8];	// all ones if bit b of rs_tal1tab[1 << j], at [b][j]
+
+
+/* The SIMD syndrome kernels read the codeword as W interleaved streams,
+   one per lane, so all lanes share the multiplier root^W: rs_synnib[g][i]
+   holds the split-nibble products by root i to the 16th (g = 0) and 32nd
+   (g = 1) power */
+#define SYN_X16 0
+#define SYN_X32 1
+static unsigned char rs_synnib[2][NP][2][16] __attribute__((aligned(16)));
+
+static void pick_batch_kernel(int lanes);
+static void pick_syndrome_kernel(int lanes);
+
+void rs_init(void)
+{
+  int x,k,g;
+
+  if(rs_ready)
+    return;
+  for(x=1;x<=NN;x++){
+    for(k=0;k<NP;k++){
+      g = k+1 <= NP/2 ? k+1 : NP-(k+1); // palindromic, G(32-j) = G(j)
+      rs_table[x][k] = rs_table[x][NP+k] =
+        CCSDS_alpha_to[modnn(CCSDS_index_of[x] + CCSDS_poly[g])];
+    }
+  }
+  for(x=0;x<=NN;x++){
+    rs_taltab[x] = 0;
+    for(k=0;k<8;k++)
+      if(x & (1 << k))
+        rs_taltab[x] ^= rs_tal[7-k];
+    rs_tal1tab[rs_taltab[x]] = x;
+  }
+  for(x=0;x<=NN;x++)
+    for(k=0;k<2*NP;k++)
+      rs_table_dual[x][k] = rs_taltab[rs_table[rs_tal1tab[x]][k]];
+  for(k=0;k<NP;k++){
+    for(x=0;x<16;x++){
+      rs_nibble[k][0][x] = rs_table[x][k];
+      rs_nibble[k][1][x] = rs_table[x << 4][k];
+      rs_nibble_dual[k][0][x] = rs_table_dual[x][k];
+      rs_nibble_dual[k][1][x] = rs_table_dual[x << 4][k];
+    }
+  }
+  for(x=0;x<16;x++){
+    rs_tal1nib[0][x] = rs_tal1tab[x];
+    rs_tal1nib[1][x] = rs_tal1tab[x << 4];
+  }
+  for(x=0;x<8;x++)
+    for(k=0;k<8;k++)
+      rs_tal1mask[x][k] = (rs_tal1tab[1 << k] >> x) & 1 ? ~0ULL : 0;
+  for(k=0;k<NP;k++){
+    for(g=0;g<2;g++){
+      int power = modnn((16 << g) * (FCR+k)*PRIM);
+      for(x=1;x<16;x++){
+        rs_synnib[g][k][0][x] = CCSDS_alpha_to[modnn(CCSDS_index_of[x] + power)];
+        rs_synnib[g][k][1][x] = CCSDS_alpha_to[modnn(CCSDS_index_of[x << 4] + power)];
+      }
+    }
+  }
+  pick_batch_kernel(0);
+  pick_syndrome_kernel(0);
+  rs_ready = 1;
+}
+
+void update_rs_table(
+   unsigned char parity[32], // 32-byte encoder state; zero before each frame
+   unsigned char c)          // Current data byte to update
+{
+  const unsigned char *row;
+  int k;
+
+  if(!rs_ready)
+    rs_init();
+  row = rs_table[c ^ parity[0]];
+  for(k=0;k<NP-1;k++)
+    parity[k] = parity[k+1] ^ row[k];
+  parity[NP-1] = row[NP-1];
+}
+
+/* The register of struct rs_encoder is rotated: parity[k] is
+   reg[(head + k) % NP].  Shifting is head++, and the slot that falls off
+   the front becomes the new parity[31], so the feedback row lines up
+   with reg[] starting at row[NP - 1 - head]. */
+void rs_encoder_init_basis(struct rs_encoder *e, int basis)
+{
+  if(!rs_ready)
+    rs_init();
+  memset(e->reg,0,sizeof(e->reg));
+  e->head = 0;
+  e->table = basis == RS_DUAL ? rs_table_dual : rs_table;
+}
+
+void rs_encoder_init(struct rs_encoder *e)
+{
+  rs_encoder_init_basis(e, RS_CONVENTIONAL);
+}
+
+void rs_encoder_update(struct rs_encoder *e, unsigned char c)
+{
+  const unsigned char *row;
+  uint64_t r,x;
+  int k;
+
+  row = &e->table[c ^ e->reg[e->head]][NP-1-e->head];
+  // XOR a word at a time; byte order does not matter to XOR
+  for(k=0;k<NP;k+=8){
+    memcpy(&r,&e->reg[k],8);
+    memcpy(&x,&row[k],8);
+    r ^= x;
+    memcpy(&e->reg[k],&r,8);
+  }
+  e->reg[e->head] = row[e->head];	// replaces the byte shifted out
+  e->head = (e->head + 1) & (NP-1);
+}
+
+void rs_encoder_parity(const struct rs_encoder *e, unsigned char parity[32])
+{
+  memcpy(parity, &e->reg[e->head], NP-e->head);
+  memcpy(&parity[NP-e->head], e->reg, e->head);
+}
+
+/* Batch encoding: the codewords of a group run in lockstep, one per byte
+   lane of a vector.  parity byte k of every codeword lives in vector p[k],
+   so the register shift is just renaming and each generator multiply is
+   two PSHUFB lookups for all the lanes at once.  Input is transposed a
+   chunk at a time into col[], byte i of every lane together. */
+
+#define RS_CHUNK 64	// codeword bytes transposed per pass
+
+// Transpose bytes [i, i + len) of up to lanes codewords into col[], zero
+// filling the lanes past n
+static void gather(unsigned char *col, const unsigned char *data, long stride,
+	long n, int lanes, int i, int len)
+{
+  for(int l=0;l<lanes;l++){
+    if(l < n){
+      const unsigned char *src = data + l*stride + i;
+      for(int j=0;j<len;j++)
+        col[j*lanes + l] = src[j];
+    } else {
+      for(int j=0;j<len;j++)
+        col[j*lanes + l] = 0;
+    }
+  }
+}
+
+#ifdef HAVE_X86
+/* gather() 8 lanes by 8 bytes at a time: three rounds of unpacks turn 8
+   rows of 8 bytes into 8 columns */
+__attribute__((target("sse2")))
+static void gather_sse2(unsigned char *col, const unsigned char *data, long stride,
+	long n, int lanes, int i, int len)
+{
+  int l = 0;
+
+  for(;l+8<=lanes && l+8<=n;l+=8){
+    const unsigned char *src = data + l*stride + i;
+    int j = 0;
+    for(;j+8<=len;j+=8){
+      __m128i r[8],a[4],b[4],c[4];
+      for(int k=0;k<8;k++)
+        r[k] = _mm_loadl_epi64((const __m128i *)(src + k*stride + j));
+      for(int k=0;k<4;k++)
+        a[k] = _mm_unpacklo_epi8(r[2*k], r[2*k+1]);
+      for(int k=0;k<2;k++){
+        b[2*k] = _mm_unpacklo_epi16(a[2*k], a[2*k+1]);
+        b[2*k+1] = _mm_unpackhi_epi16(a[2*k], a[2*k+1]);
+      }
+      for(int k=0;k<2;k++){
+        c[2*k] = _mm_unpacklo_epi32(b[k], b[k+2]);
+        c[2*k+1] = _mm_unpackhi_epi32(b[k], b[k+2]);
+      }
+      // c[k] holds columns j + 2k and j + 2k + 1
+      for(int k=0;k<4;k++){
+        _mm_storel_epi64((__m128i *)(col + (j+2*k)*lanes + l), c[k]);
+        _mm_storel_epi64((__m128i *)(col + (j+2*k+1)*lanes + l), _mm_srli_si128(c[k], 8));
+      }
+    }
+    for(;j<len;j++)
+      for(int k=0;k<8;k++)
+        col[j*lanes + l + k] = src[k*stride + j];
+  }
+  for(;l<lanes;l++)
+    for(int j=0;j<len;j++)
+      col[j*lanes + l] = l < n ? data[l*stride + i + j] : 0;
+}
+#endif
+
+static void encode_scalar(unsigned char (*parity)[NP], const unsigned char *data,
+	long n, int len, int basis)
+{
+  struct rs_encoder e;
+
+  for(long w=0;w<n;w++){
+    rs_encoder_init_basis(&e, basis);
+    for(int i=0;i<len;i++)
+      rs_encoder_update(&e, data[w*len + i]);
+    rs_encoder_parity(&e, parity[w]);
+  }
+}
+
+#ifdef HAVE_X86
+__attribute__((target("ssse3")))
+static void encode_ssse3(unsigned char (*parity)[NP], const unsigned char *data,
+	long n, int len, int basis)
+{
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  unsigned char (*nib)[2][16] = basis == RS_DUAL ? rs_nibble_dual : rs_nibble;
+  unsigned char col[RS_CHUNK*16] __attribute__((aligned(16)));
+  unsigned char out[NP][16] __attribute__((aligned(16)));
+
+  for(long w=0;w<n;w+=16){
+    __m128i p[NP];
+    for(int k=0;k<NP;k++)
+      p[k] = _mm_setzero_si128();
+    for(int i=0;i<len;i+=RS_CHUNK){
+      int m = len-i < RS_CHUNK ? len-i : RS_CHUNK;
+      gather_sse2(col, data + w*len, len, n-w, 16, i, m);
+      for(int j=0;j<m;j++){
+        __m128i fb = _mm_xor_si128(_mm_load_si128((__m128i *)(col + j*16)), p[0]);
+        __m128i lo = _mm_and_si128(fb, mask);
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(fb, 4), mask);
+        for(int k=0;k<NP-1;k++)
+          p[k] = _mm_xor_si128(p[k+1], _mm_xor_si128(
+            _mm_shuffle_epi8(_mm_load_si128((__m128i *)nib[k][0]), lo),
+            _mm_shuffle_epi8(_mm_load_si128((__m128i *)nib[k][1]), hi)));
+        p[NP-1] = fb;	// G0 = 1
+      }
+    }
+    for(int k=0;k<NP;k++)
+      _mm_store_si128((__m128i *)out[k], p[k]);
+    for(long l=0;l<16 && w+l<n;l++)
+      for(int k=0;k<NP;k++)
+        parity[w+l][k] = out[k][l];
+  }
+}
+
+__attribute__((target("avx2")))
+static void encode_avx2(unsigned char (*parity)[NP], const unsigned char *data,
+	long n, int len, int basis)
+{
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  unsigned char (*nib)[2][16] = basis == RS_DUAL ? rs_nibble_dual : rs_nibble;
+  unsigned char col[RS_CHUNK*32] __attribute__((aligned(32)));
+  unsigned char out[NP][32] __attribute__((aligned(32)));
+  __m256i tab[NP][2];
+
+  // PSHUFB looks up within each 128-bit half, so repeat the tables in both
+  for(int k=0;k<NP;k++)
+    for(int h=0;h<2;h++)
+      tab[k][h] = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)nib[k][h]));
+
+  for(long w=0;w<n;w+=32){
+    __m256i p[NP];
+    for(int k=0;k<NP;k++)
+      p[k] = _mm256_setzero_si256();
+    for(int i=0;i<len;i+=RS_CHUNK){
+      int m = len-i < RS_CHUNK ? len-i : RS_CHUNK;
+      gather_sse2(col, data + w*len, len, n-w, 32, i, m);
+      for(int j=0;j<m;j++){
+        __m256i fb = _mm256_xor_si256(_mm256_load_si256((__m256i *)(col + j*32)), p[0]);
+        __m256i lo = _mm256_and_si256(fb, mask);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(fb, 4), mask);
+        for(int k=0;k<NP-1;k++)
+          p[k] = _mm256_xor_si256(p[k+1], _mm256_xor_si256(
+            _mm256_shuffle_epi8(tab[k][0], lo), _mm256_shuffle_epi8(tab[k][1], hi)));
+        p[NP-1] = fb;	// G0 = 1
+      }
+    }
+    for(int k=0;k<NP;k++)
+      _mm256_store_si256((__m256i *)out[k], p[k]);
+    for(long l=0;l<32 && w+l<n;l++)
+      for(int k=0;k<NP;k++)
+        parity[w+l][k] = out[k][l];
+  }
+}
+#endif
+
+/* Bit-sliced batch encoding: 64 codewords to a uint64_t, or 256 to an
+   AVX2 vector, lane l in bit l, with each register byte kept as 8 bit
+   planes.  Multiplying by a generator coefficient G is then a fixed
+   network of XORs across the planes of the feedback: bit b of G * x is
+   the XOR of the bits j of x for which bit b of CCSDS_genmul[G][j] is
+   set.  The table is constant and the loops are unrolled, so the compiler
+   turns each network into straight-line code with no lookups at all.
+   The register rotates as in struct rs_encoder, and as the generator is
+   palindromic only G1..G16 need a network.  Dual basis bytes go through
+   one more network, with rs_tal1mask[] as its wiring, on their way in,
+   and the parities through rs_taltab[] on the way out. */
+
+// 8 x 8 bit transpose of the bytes of x: bit j of byte i <-> bit i of byte j
+static inline uint64_t transpose8(uint64_t x)
+{
+  uint64_t t;
+
+  t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL;
+  x ^= t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL;
+  x ^= t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL;
+  x ^= t ^ (t << 28);
+  return x;
+}
+
+// parity[lane][k] for the lanes < n from planes reg[slot][b] of W 64-bit words
+static void bitslice_out(unsigned char (*parity)[NP], long n, const uint64_t *reg,
+	int W, int head, int basis)
+{
+  for(int k=0;k<NP;k++){
+    const uint64_t *r = reg + ((head + k) & (NP-1))*8*W;
+    for(int g=0;g<8*W && 8*g<n;g++){
+      uint64_t x = 0;
+      for(int b=0;b<8;b++)
+        x |= ((r[b*W + g/8] >> (8*(g%8))) & 0xff) << (8*b);
+      x = transpose8(x);
+      for(int l=0;l<8 && 8*g+l<n;l++)
+        parity[8*g+l][k] = basis == RS_DUAL ? rs_taltab[(x >> (8*l)) & 0xff] : x >> (8*l);
+    }
+  }
+}
+
+// One data byte into the bit-sliced register, for planes of type T
+#define BITSLICE_STEP(T, reg, head, in) do {				\
+    T fb_[8];								\
+    for(int b_=0;b_<8;b_++)						\
+      fb_[b_] = (in)[b_] ^ (reg)[head][b_];				\
+    _Pragma("GCC unroll 16")						\
+    for(int g_=1;g_<=NP/2;g_++){					\
+      T *lo_ = (reg)[((head) + g_) & (NP-1)];				\
+      T *hi_ = (reg)[((head) + NP - g_) & (NP-1)];			\
+      _Pragma("GCC unroll 8")						\
+      for(int b_=0;b_<8;b_++){						\
+        T p_ = {0};							\
+        _Pragma("GCC unroll 8")						\
+        for(int j_=0;j_<8;j_++)						\
+          if((CCSDS_genmul[g_][j_] >> b_) & 1)				\
+            p_ ^= fb_[j_];						\
+        lo_[b_] ^= p_;							\
+        if(g_ < NP/2)							\
+          hi_[b_] ^= p_;						\
+      }									\
+    }									\
+    for(int b_=0;b_<8;b_++)						\
+      (reg)[head][b_] = fb_[b_];	/* G0 = 1 */			\
+  } while(0)
+
+// Dual basis planes in[] to the conventional basis; mask is rs_tal1mask[b_][j_]
+#define BITSLICE_DUAL(T, in, mask) do {					\
+    T c_[8];								\
+    for(int b_=0;b_<8;b_++){						\
+      c_[b_] = (T){0};							\
+      for(int j_=0;j_<8;j_++)						\
+        c_[b_] ^= (in)[j_] & (mask);					\
+    }									\
+    memcpy((in), c_, sizeof(c_));					\
+  } while(0)
+
+static void encode_bitslice64(unsigned char (*parity)[NP], const unsigned char *data,
+	long n, int len, int basis)
+{
+  unsigned char col[RS_CHUNK*64];
+  uint64_t reg[NP][8], in[8];
+
+  for(long w=0;w<n;w+=64){
+    int head = 0;
+    memset(reg,0,sizeof(reg));
+    for(int i=0;i<len;i+=RS_CHUNK){
+      int m = len-i < RS_CHUNK ? len-i : RS_CHUNK;
+      gather(col, data + w*len, len, n-w, 64, i, m);
+      for(int j=0;j<m;j++){
+        memset(in,0,sizeof(in));
+        for(int g=0;g<8;g++){
+          uint64_t x;
+          memcpy(&x, col + j*64 + 8*g, 8);
+          x = transpose8(x);
+          for(int b=0;b<8;b++)
+            in[b] |= ((x >> (8*b)) & 0xff) << (8*g);
+        }
+        if(basis == RS_DUAL)
+          BITSLICE_DUAL(uint64_t, in, rs_tal1mask[b_][j_]);
+        BITSLICE_STEP(uint64_t, reg, head, in);
+        head = (head + 1) & (NP-1);
+      }
+    }
+    bitslice_out(parity + w, n-w, &reg[0][0], 1, head, basis);
+  }
+}
+
+#ifdef HAVE_X86
+__attribute__((target("avx2")))
+static void encode_bitslice256(unsigned char (*parity)[NP], const unsigned char *data,
+	long n, int len, int basis)
+{
+  unsigned char col[RS_CHUNK*256] __attribute__((aligned(32)));
+  __m256i reg[NP][8], in[8];
+  uint32_t bits[8][8];
+
+  for(long w=0;w<n;w+=256){
+    int head = 0;
+    memset(reg,0,sizeof(reg));
+    for(int i=0;i<len;i+=RS_CHUNK){
+      int m = len-i < RS_CHUNK ? len-i : RS_CHUNK;
+      gather_sse2(col, data + w*len, len, n-w, 256, i, m);
+      for(int j=0;j<m;j++){
+        // PMOVMSKB takes the top bit of each of 32 lanes at once
+        for(int q=0;q<8;q++){
+          __m256i v = _mm256_load_si256((__m256i *)(col + j*256 + 32*q));
+          for(int b=7;b>=0;b--){
+            bits[b][q] = _mm256_movemask_epi8(v);
+            v = _mm256_add_epi8(v, v);
+          }
+        }
+        for(int b=0;b<8;b++)
+          in[b] = _mm256_loadu_si256((__m256i *)bits[b]);
+        if(basis == RS_DUAL)
+          BITSLICE_DUAL(__m256i, in, _mm256_set1_epi64x(rs_tal1mask[b_][j_]));
+        BITSLICE_STEP(__m256i, reg, head, in);
+        head = (head + 1) & (NP-1);
+      }
+    }
+    bitslice_out(parity + w, n-w, (const uint64_t *)reg, 4, head, basis);
+  }
+}
+#endif
+
+static void (*encode_batch)(unsigned char (*)[NP], const unsigned char *, long, int, int);
+static int batch_lanes;
+
+static void pick_batch_kernel(int lanes)
+{
+  if(lanes <= 0)
+    lanes = 32;
+  encode_batch = encode_scalar;
+  batch_lanes = 1;
+#ifdef HAVE_X86
+  __builtin_cpu_init();
+  if(lanes >= 256 && __builtin_cpu_supports("avx2")){
+    encode_batch = encode_bitslice256;
+    batch_lanes = 256;
+    return;
+  }
+#endif
+  if(lanes >= 64){
+    encode_batch = encode_bitslice64;
+    batch_lanes = 64;
+    return;
+  }
+#ifdef HAVE_X86
+  if(lanes >= 32 && __builtin_cpu_supports("avx2")){
+    encode_batch = encode_avx2;
+    batch_lanes = 32;
+  } else if(lanes >= 16 && __builtin_cpu_supports("ssse3")){
+    encode_batch = encode_ssse3;
+    batch_lanes = 16;
+  }
+#endif
+}
+
+int rs_batch_select(int lanes)
+{
+  rs_init();
+  pick_batch_kernel(lanes);
+  return batch_lanes;
+}
+
+void rs_encode_batch_basis(
+   unsigned char (*parity)[32], // n parity outputs
+   const unsigned char *data,   // n codewords of len bytes, back to back
+   long n,
+   int len,
+   int basis)
+{
+  if(!rs_ready)
+    rs_init();
+  encode_batch(parity, data, n, len, basis);
+}
+
+void rs_encode_batch(unsigned char (*parity)[32], const unsigned char *data,
+   long n, int len)
+{
+  rs_encode_batch_basis(parity, data, n, len, RS_CONVENTIONAL);
+}
+
+/* Syndromes.  The plain C kernel, ccsds_syndromes(), is Horner's rule
+   with one CCSDS_synmul[] lookup per root per byte.  The SIMD kernels split the codeword into W
+   = 16 or 32 interleaved streams, zero padded at the front to a whole
+   number of blocks, and run Horner's rule on all of them at once by
+   root^W (two PSHUFB lookups).  Lane t then still has to be multiplied
+   by root^(W-1-t): with 32 lanes the lower half is multiplied by root^16
+   and folded onto the upper half, and the last 16 are finished off by
+   Horner's rule in plain C.  Each kernel has a dual basis twin, which
+   converts the bytes with rs_tal1tab[] (two more PSHUFB lookups a
+   block) as it reads them. */
+#ifdef HAVE_X86
+// a times the constant whose split-nibble products are at tab
+__attribute__((target("ssse3")))
+static inline __m128i mul_ssse3(__m128i a, const unsigned char tab[2][16])
+{
+  const __m128i mask = _mm_set1_epi8(0x0f);
+
+  return _mm_xor_si128(
+    _mm_shuffle_epi8(_mm_load_si128((const __m128i *)tab[0]), _mm_and_si128(a, mask)),
+    _mm_shuffle_epi8(_mm_load_si128((const __m128i *)tab[1]), _mm_and_si128(_mm_srli_epi16(a, 4), mask)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i mul_avx2(__m256i a, const unsigned char tab[2][16])
+{
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+
+  return _mm256_xor_si256(
+    _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128((const __m128i *)tab[0])),
+      _mm256_and_si256(a, mask)),
+    _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128((const __m128i *)tab[1])),
+      _mm256_and_si256(_mm256_srli_epi16(a, 4), mask)));
+}
+
+// Finish syndrome i from its 16 lane sums
+__attribute__((target("ssse3")))
+static unsigned char finish_ssse3(__m128i a, int i)
+{
+  unsigned char acc[16] __attribute__((aligned(16)));
+  unsigned char sum = 0;
+
+  _mm_store_si128((__m128i *)acc, a);
+  for(int t=0;t<16;t++)
+    sum = CCSDS_synmul[i][sum] ^ acc[t];
+  return sum;
+}
+
+// tal is rs_tal1nib for dual basis bytes, NULL for conventional ones
+__attribute__((target("ssse3"), always_inline))
+static inline int syndromes_ssse3_basis(const unsigned char *data, int len, unsigned char s[NP],
+	const unsigned char tal[2][16])
+{
+  unsigned char first[16] __attribute__((aligned(16))) = { 0 };
+  int rem = len % 16, blocks = len / 16, any = 0;
+
+  memcpy(first + 16 - rem, data, rem);
+  if(tal)
+    _mm_store_si128((__m128i *)first, mul_ssse3(_mm_load_si128((__m128i *)first), tal));
+  data += rem;
+  for(int i=0;i<NP;i+=4){
+    // four roots at a time, to overlap their dependency chains
+    __m128i a[4];
+    for(int r=0;r<4;r++)
+      a[r] = _mm_load_si128((__m128i *)first);
+    for(int b=0;b<blocks;b++){
+      __m128i in = _mm_loadu_si128((const __m128i *)(data + 16*b));
+      if(tal)
+        in = mul_ssse3(in, tal);
+#pragma GCC unroll 4	// keep a[] in registers
+      for(int r=0;r<4;r++)
+        a[r] = _mm_xor_si128(in, mul_ssse3(a[r], rs_synnib[SYN_X16][i+r]));
+    }
+    for(int r=0;r<4;r++)
+      any |= s[i+r] = finish_ssse3(a[r], i+r);
+  }
+  return any;
+}
+
+__attribute__((target("ssse3")))
+static int syndromes_ssse3(const unsigned char *data, int len, unsigned char s[NP])
+{
+  return syndromes_ssse3_basis(data, len, s, NULL);
+}
+
+__attribute__((target("ssse3")))
+static int syndromes_dual_ssse3(const unsigned char *data, int len, unsigned char s[NP])
+{
+  return syndromes_ssse3_basis(data, len, s, rs_tal1nib);
+}
+
+__attribute__((target("avx2"), always_inline))
+static inline int syndromes_avx2_basis(const unsigned char *data, int len, unsigned char s[NP],
+	const unsigned char tal[2][16])
+{
+  unsigned char first[32] __attribute__((aligned(32))) = { 0 };
+  int rem = len % 32, blocks = len / 32, any = 0;
+
+  memcpy(first + 32 - rem, data, rem);
+  if(tal)
+    _mm256_store_si256((__m256i *)first, mul_avx2(_mm256_load_si256((__m256i *)first), tal));
+  data += rem;
+  for(int i=0;i<NP;i+=4){
+    __m256i a[4];
+    for(int r=0;r<4;r++)
+      a[r] = _mm256_load_si256((__m256i *)first);
+    for(int b=0;b<blocks;b++){
+      __m256i in = _mm256_loadu_si256((const __m256i *)(data + 32*b));
+      if(tal)
+        in = mul_avx2(in, tal);
+#pragma GCC unroll 4
+      for(int r=0;r<4;r++)
+        a[r] = _mm256_xor_si256(in, mul_avx2(a[r], rs_synnib[SYN_X32][i+r]));
+    }
+    for(int r=0;r<4;r++){
+      __m256i m = mul_avx2(a[r], rs_synnib[SYN_X16][i+r]);
+      __m128i h = _mm_xor_si128(_mm256_castsi256_si128(m), _mm256_extracti128_si256(a[r], 1));
+      any |= s[i+r] = finish_ssse3(h, i+r);
+    }
+  }
+  return any;
+}
+
+__attribute__((target("avx2")))
+static int syndromes_avx2(const unsigned char *data, int len, unsigned char s[NP])
+{
+  return syndromes_avx2_basis(data, len, s, NULL);
+}
+
+__attribute__((target("avx2")))
+static int syndromes_dual_avx2(const unsigned char *data, int len, unsigned char s[NP])
+{
+  return syndromes_avx2_basis(data, len, s, rs_tal1nib);
+}
+#endif
+
+static int syndromes_dual_c(const unsigned char *data, int len, unsigned char s[NP])
+{
+  int i,j,any = 0;
+  unsigned char c;
+
+  c = rs_tal1tab[data[0]];
+  for(i=0;i<NP;i++)
+    s[i] = c;
+  for(j=1;j<len;j++){
+    c = rs_tal1tab[data[j]];
+    for(i=0;i<NP;i++)
+      s[i] = CCSDS_synmul[i][s[i]] ^ c;
+  }
+  for(i=0;i<NP;i++)
+    any |= s[i];
+  return any;
+}
+
+// indexed by basis
+static int (*syndrome_kernel[2])(const unsigned char *, int, unsigned char *);
+static int syndrome_lanes;
+
+static void pick_syndrome_kernel(int lanes)
+{
+  if(lanes <= 0)
+    lanes = 32;
+  syndrome_kernel[RS_CONVENTIONAL] = ccsds_syndromes;
+  syndrome_kernel[RS_DUAL] = syndromes_dual_c;
+  syndrome_lanes = 1;
+#ifdef HAVE_X86
+  __builtin_cpu_init();
+  if(lanes >= 32 && __builtin_cpu_supports("avx2")){
+    syndrome_kernel[RS_CONVENTIONAL] = syndromes_avx2;
+    syndrome_kernel[RS_DUAL] = syndromes_dual_avx2;
+    syndrome_lanes = 32;
+  } else if(lanes >= 16 && __builtin_cpu_supports("ssse3")){
+    syndrome_kernel[RS_CONVENTIONAL] = syndromes_ssse3;
+    syndrome_kernel[RS_DUAL] = syndromes_dual_ssse3;
+    syndrome_lanes = 16;
+  }
+#endif
+}
+
+int rs_syndrome_select(int lanes)
+{
+  rs_init();
+  pick_syndrome_kernel(lanes);
+  return syndrome_lanes;
+}
+
+int rs_syndromes(const unsigned char *data, int len, unsigned char s[32])
+{
+  if(!rs_ready)
+    rs_init();
+  return syndrome_kernel[RS_CONVENTIONAL](data, len, s);
+}
+
+void rs_to_dual(unsigned char *data, int len)
+{
+  if(!rs_ready)
+    rs_init();
+  for(int i=0;i<len;i++)
+    data[i] = rs_taltab[data[i]];
+}
+
+void rs_from_dual(unsigned char *data, int len)
+{
+  if(!rs_ready)
+    rs_init();
+  for(int i=0;i<len;i++)
+    data[i] = rs_tal1tab[data[i]];
+}
+
+/* A shortened code is the full code with pad = NN - (data_len + NP)
+   virtual zeros in front, which are never sent.  The encoders need
+   nothing for them: zeros into a clear register leave it clear.  Nor do
+   the syndromes, as Horner's rule starts from the first real byte.  The
+   Chien search is started at the first real position instead of root
+   alpha^1, so it only ever looks at the len positions sent: lambda(x) is
+   evaluated at X^-1 = alpha^-(PRIM*(NN-1-k)) for position k, which
+   advances by alpha^PRIM from one position to the next. */
+int rs_code_init_basis(struct rs_code *c, int data_len, int basis)
+{
+  if(basis != RS_CONVENTIONAL && basis != RS_DUAL)
+    return -1;
+  if((c->root_start = ccsds_chien_init(data_len, c->chien_start)) < 0)
+    return -1;
+  c->data_len = data_len;
+  c->basis = basis;
+  c->pad = NN - (data_len + NP);
+  return 0;
+}
+
+int rs_code_init(struct rs_code *c, int data_len)
+{
+  return rs_code_init_basis(c, data_len, RS_CONVENTIONAL);
+}
+
+int rs_decode(
+   unsigned char *data, // data_len data bytes then NP parities, fixed in place
+   int data_len,        // 223, or fewer for a shortened code
+   const int *eras_pos, // erased byte positions in data[], or NULL
+   int no_eras)
+{
+  struct rs_code c;
+
+  if(rs_code_init(&c,data_len) != 0)
+    return -1;
+  return rs_decode_code(&c,data,eras_pos,no_eras);
+}
+
+/* The errors and erasures decoder itself is ccsds_decode_syn() in
+   rs_template.h.  Dual basis codewords are decoded in the conventional
+   basis from their converted syndromes, and only the corrections are
+   converted back. */
+int rs_decode_code(
+   const struct rs_code *c,
+   unsigned char *data, // data_len data bytes then NP parities, fixed in place
+   const int *eras_pos, // erased byte positions in data[], or NULL
+   int no_eras)
+{
+  unsigned char s[NP];
+
+  if(!rs_ready)
+    rs_init();
+  if(no_eras < 0 || no_eras > (int)NP)
+    return -1;
+  if(!syndrome_kernel[c->basis](data, c->data_len + NP, s))
+    return 0; // a clean codeword, nothing to correct
+  return ccsds_decode_syn(data, c->data_len, c->root_start, c->chien_start,
+    eras_pos, no_eras, s, c->basis == RS_DUAL ? rs_taltab : NULL);
+}
@@ -0,0 +1,108 @@
+/* rs.h
+ * CCSDS Reed-Solomon (255,223) encoders and decoder.
+ *
+ * update_rs() in make_wav.h is Phil Karn's byte-at-a-time reference
+ * encoder.  The encoders here produce exactly the same parities, faster.
+ * rs_decode() corrects what they produce.
+ *
+ * The symbols are normally in the conventional (polynomial) basis, as
+ * update_rs() has them.  CCSDS links send them in Berlekamp's dual basis
+ * instead; the _basis versions of the encoders and decoder take and give
+ * dual basis bytes directly when asked for RS_DUAL.
+ */
+
+#ifndef RS_H
+#define RS_H
+
+#define RS_CONVENTIONAL 0	// polynomial basis, as update_rs()
+#define RS_DUAL 1		// CCSDS dual basis
+
+void update_rs_table(
+   unsigned char parity[32], // 32-byte encoder state; zero before each frame
+   unsigned char c);         // Current data byte to update
+    /* same as update_rs(), with one row of a 256 x 32 product table
+       XORed into the register per byte */
+
+/* Encoder state for one codeword.  The parity register is rotated in
+   place instead of shifted, and put back in order by rs_encoder_parity()
+   once the data is done. */
+struct rs_encoder {
+	unsigned char reg[32];
+	int head;		// reg[] index of parity[0]
+	const unsigned char (*table)[64];	// generator products for the basis
+};
+
+void rs_encoder_init(struct rs_encoder *e);
+    /* start a new codeword */
+void rs_encoder_init_basis(struct rs_encoder *e, int basis);
+    /* start a new codeword of RS_CONVENTIONAL or RS_DUAL bytes; the
+       parities come out in the same basis */
+void rs_encoder_update(struct rs_encoder *e, unsigned char c);
+    /* add the next data byte */
+void rs_encoder_parity(const struct rs_encoder *e, unsigned char parity[32]);
+    /* the parities so far, parity[0] first, as update_rs() leaves them */
+
+void rs_encode_batch(
+   unsigned char (*parity)[32], // n parity outputs
+   const unsigned char *data,   // n codewords of len bytes, back to back
+   long n,
+   int len);                    // 223, or fewer for a shortened code
+    /* encode n whole codewords, 16 or 32 at a time in SIMD lanes when the
+       CPU has SSSE3 or AVX2, or 64 or 256 bit-sliced if rs_batch_select()
+       asked for them; the same parities as update_rs() */
+void rs_encode_batch_basis(unsigned char (*parity)[32], const unsigned char *data,
+   long n, int len, int basis);
+    /* rs_encode_batch() for codewords in the given basis */
+
+int rs_decode(
+   unsigned char *data, // data_len data bytes then 32 parities, fixed in place
+   int data_len,        // 223, or fewer for a shortened code (159, 158, 64)
+   const int *eras_pos, // erased byte positions in data[], or NULL
+   int no_eras);
+    /* correct up to e errors and f erasures with 2e + f <= 32; returns the
+       number of bytes found in error (0 for a clean codeword, straight
+       after the syndromes) or -1, leaving data alone, if uncorrectable */
+
+/* A shortened code, set up once: the decoder then only does work for the
+   data_len + 32 bytes actually sent, none for the virtual zeros */
+struct rs_code {
+	int data_len;
+	int basis;			// RS_CONVENTIONAL or RS_DUAL
+	int pad;			// virtual zeros in front of the data
+	int root_start;			// Chien search root for the first byte sent
+	unsigned char chien_start[33];	// j * root_start, for lambda term j
+};
+
+int rs_code_init(struct rs_code *c, int data_len);
+    /* returns 0, or -1 if data_len is not 1..223 */
+int rs_code_init_basis(struct rs_code *c, int data_len, int basis);
+    /* the same for codewords sent in the given basis */
+int rs_decode_code(const struct rs_code *c, unsigned char *data,
+   const int *eras_pos, int no_eras);
+    /* rs_decode() for the code c */
+
+int rs_syndromes(const unsigned char *data, int len, unsigned char s[32]);
+    /* the 32 syndromes of a len byte codeword (shortened: data, then
+       parities), in polynomial form; returns 0, the clean codeword case,
+       only if they are all zero.  SSSE3 or AVX2 when there is one. */
+
+void rs_to_dual(unsigned char *data, int len);
+void rs_from_dual(unsigned char *data, int len);
+    /* convert len bytes in place between the conventional and the dual
+       basis, for test vectors; the encoders and decoder do not need them */
+
+int rs_syndrome_select(int lanes);
+    /* as rs_batch_select(), for rs_syndromes() */
+
+int rs_batch_select(int lanes);
+    /* use the widest batch kernel of at most lanes lanes: 1 is plain C,
+       16 and 32 SSSE3 and AVX2, 64 and 256 bit-sliced in uint64_t or
+       AVX2.  0, the default, is the widest of 1..32, which is as fast
+       as 256 and needs far fewer codewords to fill.  Returns the lanes
+       now in use. */
+
+void rs_init(void);
+    /* build the tables; called on first use, but call it up front before
+       encoding from several threads */
+
+#endif /* RS_H */
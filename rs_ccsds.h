@@ -0,0 +1,683 @@
+/* rs_ccsds.h
+ * Generated by rs_gen ccsds 0x187 112 11 32 -- do not edit.
+ */
+
+#ifndef RS_CCSDS_H
+#define RS_CCSDS_H
+
+#define CCSDS_MM 8		// bits per symbol
+#define CCSDS_NN 255	// symbols per codeword
+#define CCSDS_NROOTS 32	// parity symbols
+#define CCSDS_FCR 112	// first consecutive root, index form
+#define CCSDS_PRIM 11	// spacing of the roots
+#define CCSDS_GFPOLY 0x187	// field generator polynomial
+
+// GF antilog table; CCSDS_alpha_to[CCSDS_NN] = 0
+static const unsigned char CCSDS_alpha_to[CCSDS_NN+1] = {
+0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xad, 0xdd, 0x3d, 0x7a, 0xf4,
+0x6f, 0xde, 0x3b, 0x76, 0xec, 0x5f, 0xbe, 0xfb, 0x71, 0xe2, 0x43, 0x86, 0x8b, 0x91, 0xa5, 0xcd,
+0x1d, 0x3a, 0x74, 0xe8, 0x57, 0xae, 0xdb, 0x31, 0x62, 0xc4, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0x67,
+0xce, 0x1b, 0x36, 0x6c, 0xd8, 0x37, 0x6e, 0xdc, 0x3f, 0x7e, 0xfc, 0x7f, 0xfe, 0x7b, 0xf6, 0x6b,
+0xd6, 0x2b, 0x56, 0xac, 0xdf, 0x39, 0x72, 0xe4, 0x4f, 0x9e, 0xbb, 0xf1, 0x65, 0xca, 0x13, 0x26,
+0x4c, 0x98, 0xb7, 0xe9, 0x55, 0xaa, 0xd3, 0x21, 0x42, 0x84, 0x8f, 0x99, 0xb5, 0xed, 0x5d, 0xba,
+0xf3, 0x61, 0xc2, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0,
+0x47, 0x8e, 0x9b, 0xb1, 0xe5, 0x4d, 0x9a, 0xb3, 0xe1, 0x45, 0x8a, 0x93, 0xa1, 0xc5, 0x0d, 0x1a,
+0x34, 0x68, 0xd0, 0x27, 0x4e, 0x9c, 0xbf, 0xf9, 0x75, 0xea, 0x53, 0xa6, 0xcb, 0x11, 0x22, 0x44,
+0x88, 0x97, 0xa9, 0xd5, 0x2d, 0x5a, 0xb4, 0xef, 0x59, 0xb2, 0xe3, 0x41, 0x82, 0x83, 0x81, 0x85,
+0x8d, 0x9d, 0xbd, 0xfd, 0x7d, 0xfa, 0x73, 0xe6, 0x4b, 0x96, 0xab, 0xd1, 0x25, 0x4a, 0x94, 0xaf,
+0xd9, 0x35, 0x6a, 0xd4, 0x2f, 0x5e, 0xbc, 0xff, 0x79, 0xf2, 0x63, 0xc6, 0x0b, 0x16, 0x2c, 0x58,
+0xb0, 0xe7, 0x49, 0x92, 0xa3, 0xc1, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0xc7, 0x09, 0x12, 0x24,
+0x48, 0x90, 0xa7, 0xc9, 0x15, 0x2a, 0x54, 0xa8, 0xd7, 0x29, 0x52, 0xa4, 0xcf, 0x19, 0x32, 0x64,
+0xc8, 0x17, 0x2e, 0x5c, 0xb8, 0xf7, 0x69, 0xd2, 0x23, 0x46, 0x8c, 0x9f, 0xb9, 0xf5, 0x6d, 0xda,
+0x33, 0x66, 0xcc, 0x1f, 0x3e, 0x7c, 0xf8, 0x77, 0xee, 0x5b, 0xb6, 0xeb, 0x51, 0xa2, 0xc3, 0x00,
+};
+
+// GF log table; log(0) is CCSDS_NN
+static const unsigned char CCSDS_index_of[CCSDS_NN+1] = {
+255,   0,   1,  99,   2, 198, 100, 106,   3, 205, 199, 188, 101, 126, 107,  42,
+  4, 141, 206,  78, 200, 212, 189, 225, 102, 221, 127,  49, 108,  32,  43, 243,
+  5,  87, 142, 232, 207, 172,  79, 131, 201, 217, 213,  65, 190, 148, 226, 180,
+103,  39, 222, 240, 128, 177,  50,  53, 109,  69,  33,  18,  44,  13, 244,  56,
+  6, 155,  88,  26, 143, 121, 233, 112, 208, 194, 173, 168,  80, 117, 132,  72,
+202, 252, 218, 138, 214,  84,  66,  36, 191, 152, 149, 249, 227,  94, 181,  21,
+104,  97,  40, 186, 223,  76, 241,  47, 129, 230, 178,  63,  51, 238,  54,  16,
+110,  24,  70, 166,  34, 136,  19, 247,  45, 184,  14,  61, 245, 164,  57,  59,
+  7, 158, 156, 157,  89, 159,  27,   8, 144,   9, 122,  28, 234, 160, 113,  90,
+209,  29, 195, 123, 174,  10, 169, 145,  81,  91, 118, 114, 133, 161,  73, 235,
+203, 124, 253, 196, 219,  30, 139, 210, 215, 146,  85, 170,  67,  11,  37, 175,
+192, 115, 153, 119, 150,  92, 250,  82, 228, 236,  95,  74, 182, 162,  22, 134,
+105, 197,  98, 254,  41, 125, 187, 204, 224, 211,  77, 140, 242,  31,  48, 220,
+130, 171, 231,  86, 179, 147,  64, 216,  52, 176, 239,  38,  55,  12,  17,  68,
+111, 120,  25, 154,  71, 116, 167, 193,  35,  83, 137, 251,  20,  93, 248, 151,
+ 46,  75, 185,  96,  15, 237,  62, 229, 246, 135, 165,  23,  58, 163,  60, 183,
+};
+
+// Generator polynomial in index form, coefficient of x^i at [i]
+static const unsigned char CCSDS_poly[CCSDS_NROOTS+1] = {
+  0, 249,  59,  66,   4,  43, 126, 251,  97,  30,   3, 213,  50,  66, 170,   5,
+ 24,   5, 170,  66,  50, 213,   3,  30,  97, 251, 126,  43,   4,  66,  59, 249,
+  0,
+};
+
+// CCSDS_genmul[i][j] = generator coefficient i times alpha^j, for bit-sliced encoders
+static const unsigned char CCSDS_genmul[CCSDS_NROOTS+1][CCSDS_MM] = {
+{0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80},
+{0x5b, 0xb6, 0xeb, 0x51, 0xa2, 0xc3, 0x01, 0x02},
+{0x7f, 0xfe, 0x7b, 0xf6, 0x6b, 0xd6, 0x2b, 0x56},
+{0x56, 0xac, 0xdf, 0x39, 0x72, 0xe4, 0x4f, 0x9e},
+{0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xad},
+{0x1e, 0x3c, 0x78, 0xf0, 0x67, 0xce, 0x1b, 0x36},
+{0x0d, 0x1a, 0x34, 0x68, 0xd0, 0x27, 0x4e, 0x9c},
+{0xeb, 0x51, 0xa2, 0xc3, 0x01, 0x02, 0x04, 0x08},
+{0x61, 0xc2, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60},
+{0xa5, 0xcd, 0x1d, 0x3a, 0x74, 0xe8, 0x57, 0xae},
+{0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95},
+{0x2a, 0x54, 0xa8, 0xd7, 0x29, 0x52, 0xa4, 0xcf},
+{0x36, 0x6c, 0xd8, 0x37, 0x6e, 0xdc, 0x3f, 0x7e},
+{0x56, 0xac, 0xdf, 0x39, 0x72, 0xe4, 0x4f, 0x9e},
+{0xab, 0xd1, 0x25, 0x4a, 0x94, 0xaf, 0xd9, 0x35},
+{0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xad, 0xdd},
+{0x71, 0xe2, 0x43, 0x86, 0x8b, 0x91, 0xa5, 0xcd},
+{0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xad, 0xdd},
+{0xab, 0xd1, 0x25, 0x4a, 0x94, 0xaf, 0xd9, 0x35},
+{0x56, 0xac, 0xdf, 0x39, 0x72, 0xe4, 0x4f, 0x9e},
+{0x36, 0x6c, 0xd8, 0x37, 0x6e, 0xdc, 0x3f, 0x7e},
+{0x2a, 0x54, 0xa8, 0xd7, 0x29, 0x52, 0xa4, 0xcf},
+{0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95},
+{0xa5, 0xcd, 0x1d, 0x3a, 0x74, 0xe8, 0x57, 0xae},
+{0x61, 0xc2, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60},
+{0xeb, 0x51, 0xa2, 0xc3, 0x01, 0x02, 0x04, 0x08},
+{0x0d, 0x1a, 0x34, 0x68, 0xd0, 0x27, 0x4e, 0x9c},
+{0x1e, 0x3c, 0x78, 0xf0, 0x67, 0xce, 0x1b, 0x36},
+{0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xad},
+{0x56, 0xac, 0xdf, 0x39, 0x72, 0xe4, 0x4f, 0x9e},
+{0x7f, 0xfe, 0x7b, 0xf6, 0x6b, 0xd6, 0x2b, 0x56},
+{0x5b, 0xb6, 0xeb, 0x51, 0xa2, 0xc3, 0x01, 0x02},
+{0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80},
+};
+
+// CCSDS_synmul[i][x] = x * alpha^((FCR + i) * PRIM)
+static const unsigned char CCSDS_synmul[CCSDS_NROOTS][CCSDS_NN+1] = {
+{
+0x00, 0x15, 0x2a, 0x3f, 0x54, 0x41, 0x7e, 0x6b, 0xa8, 0xbd, 0x82, 0x97, 0xfc, 0xe9, 0xd6, 0xc3,
+0xd7, 0xc2, 0xfd, 0xe8, 0x83, 0x96, 0xa9, 0xbc, 0x7f, 0x6a, 0x55, 0x40, 0x2b, 0x3e, 0x01, 0x14,
+0x29, 0x3c, 0x03, 0x16, 0x7d, 0x68, 0x57, 0x42, 0x81, 0x94, 0xab, 0xbe, 0xd5, 0xc0, 0xff, 0xea,
+0xfe, 0xeb, 0xd4, 0xc1, 0xaa, 0xbf, 0x80, 0x95, 0x56, 0x43, 0x7c, 0x69, 0x02, 0x17, 0x28, 0x3d,
+0x52, 0x47, 0x78, 0x6d, 0x06, 0x13, 0x2c, 0x39, 0xfa, 0xef, 0xd0, 0xc5, 0xae, 0xbb, 0x84, 0x91,
+0x85, 0x90, 0xaf, 0xba, 0xd1, 0xc4, 0xfb, 0xee, 0x2d, 0x38, 0x07, 0x12, 0x79, 0x6c, 0x53, 0x46,
+0x7b, 0x6e, 0x51, 0x44, 0x2f, 0x3a, 0x05, 0x10, 0xd3, 0xc6, 0xf9, 0xec, 0x87, 0x92, 0xad, 0xb8,
+0xac, 0xb9, 0x86, 0x93, 0xf8, 0xed, 0xd2, 0xc7, 0x04, 0x11, 0x2e, 0x3b, 0x50, 0x45, 0x7a, 0x6f,
+0xa4, 0xb1, 0x8e, 0x9b, 0xf0, 0xe5, 0xda, 0xcf, 0x0c, 0x19, 0x26, 0x33, 0x58, 0x4d, 0x72, 0x67,
+0x73, 0x66, 0x59, 0x4c, 0x27, 0x32, 0x0d, 0x18, 0xdb, 0xce, 0xf1, 0xe4, 0x8f, 0x9a, 0xa5, 0xb0,
+0x8d, 0x98, 0xa7, 0xb2, 0xd9, 0xcc, 0xf3, 0xe6, 0x25, 0x30, 0x0f, 0x1a, 0x71, 0x64, 0x5b, 0x4e,
+0x5a, 0x4f, 0x70, 0x65, 0x0e, 0x1b, 0x24, 0x31, 0xf2, 0xe7, 0xd8, 0xcd, 0xa6, 0xb3, 0x8c, 0x99,
+0xf6, 0xe3, 0xdc, 0xc9, 0xa2, 0xb7, 0x88, 0x9d, 0x5e, 0x4b, 0x74, 0x61, 0x0a, 0x1f, 0x20, 0x35,
+0x21, 0x34, 0x0b, 0x1e, 0x75, 0x60, 0x5f, 0x4a, 0x89, 0x9c, 0xa3, 0xb6, 0xdd, 0xc8, 0xf7, 0xe2,
+0xdf, 0xca, 0xf5, 0xe0, 0x8b, 0x9e, 0xa1, 0xb4, 0x77, 0x62, 0x5d, 0x48, 0x23, 0x36, 0x09, 0x1c,
+0x08, 0x1d, 0x22, 0x37, 0x5c, 0x49, 0x76, 0x63, 0xa0, 0xb5, 0x8a, 0x9f, 0xf4, 0xe1, 0xde, 0xcb,
+},
+{
+0x00, 0x64, 0xc8, 0xac, 0x17, 0x73, 0xdf, 0xbb, 0x2e, 0x4a, 0xe6, 0x82, 0x39, 0x5d, 0xf1, 0x95,
+0x5c, 0x38, 0x94, 0xf0, 0x4b, 0x2f, 0x83, 0xe7, 0x72, 0x16, 0xba, 0xde, 0x65, 0x01, 0xad, 0xc9,
+0xb8, 0xdc, 0x70, 0x14, 0xaf, 0xcb, 0x67, 0x03, 0x96, 0xf2, 0x5e, 0x3a, 0x81, 0xe5, 0x49, 0x2d,
+0xe4, 0x80, 0x2c, 0x48, 0xf3, 0x97, 0x3b, 0x5f, 0xca, 0xae, 0x02, 0x66, 0xdd, 0xb9, 0x15, 0x71,
+0xf7, 0x93, 0x3f, 0x5b, 0xe0, 0x84, 0x28, 0x4c, 0xd9, 0xbd, 0x11, 0x75, 0xce, 0xaa, 0x06, 0x62,
+0xab, 0xcf, 0x63, 0x07, 0xbc, 0xd8, 0x74, 0x10, 0x85, 0xe1, 0x4d, 0x29, 0x92, 0xf6, 0x5a, 0x3e,
+0x4f, 0x2b, 0x87, 0xe3, 0x58, 0x3c, 0x90, 0xf4, 0x61, 0x05, 0xa9, 0xcd, 0x76, 0x12, 0xbe, 0xda,
+0x13, 0x77, 0xdb, 0xbf, 0x04, 0x60, 0xcc, 0xa8, 0x3d, 0x59, 0xf5, 0x91, 0x2a, 0x4e, 0xe2, 0x86,
+0x69, 0x0d, 0xa1, 0xc5, 0x7e, 0x1a, 0xb6, 0xd2, 0x47, 0x23, 0x8f, 0xeb, 0x50, 0x34, 0x98, 0xfc,
+0x35, 0x51, 0xfd, 0x99, 0x22, 0x46, 0xea, 0x8e, 0x1b, 0x7f, 0xd3, 0xb7, 0x0c, 0x68, 0xc4, 0xa0,
+0xd1, 0xb5, 0x19, 0x7d, 0xc6, 0xa2, 0x0e, 0x6a, 0xff, 0x9b, 0x37, 0x53, 0xe8, 0x8c, 0x20, 0x44,
+0x8d, 0xe9, 0x45, 0x21, 0x9a, 0xfe, 0x52, 0x36, 0xa3, 0xc7, 0x6b, 0x0f, 0xb4, 0xd0, 0x7c, 0x18,
+0x9e, 0xfa, 0x56, 0x32, 0x89, 0xed, 0x41, 0x25, 0xb0, 0xd4, 0x78, 0x1c, 0xa7, 0xc3, 0x6f, 0x0b,
+0xc2, 0xa6, 0x0a, 0x6e, 0xd5, 0xb1, 0x1d, 0x79, 0xec, 0x88, 0x24, 0x40, 0xfb, 0x9f, 0x33, 0x57,
+0x26, 0x42, 0xee, 0x8a, 0x31, 0x55, 0xf9, 0x9d, 0x08, 0x6c, 0xc0, 0xa4, 0x1f, 0x7b, 0xd7, 0xb3,
+0x7a, 0x1e, 0xb2, 0xd6, 0x6d, 0x09, 0xa5, 0xc1, 0x54, 0x30, 0x9c, 0xf8, 0x43, 0x27, 0x8b, 0xef,
+},
+{
+0x00, 0x8c, 0x9f, 0x13, 0xb9, 0x35, 0x26, 0xaa, 0xf5, 0x79, 0x6a, 0xe6, 0x4c, 0xc0, 0xd3, 0x5f,
+0x6d, 0xe1, 0xf2, 0x7e, 0xd4, 0x58, 0x4b, 0xc7, 0x98, 0x14, 0x07, 0x8b, 0x21, 0xad, 0xbe, 0x32,
+0xda, 0x56, 0x45, 0xc9, 0x63, 0xef, 0xfc, 0x70, 0x2f, 0xa3, 0xb0, 0x3c, 0x96, 0x1a, 0x09, 0x85,
+0xb7, 0x3b, 0x28, 0xa4, 0x0e, 0x82, 0x91, 0x1d, 0x42, 0xce, 0xdd, 0x51, 0xfb, 0x77, 0x64, 0xe8,
+0x33, 0xbf, 0xac, 0x20, 0x8a, 0x06, 0x15, 0x99, 0xc6, 0x4a, 0x59, 0xd5, 0x7f, 0xf3, 0xe0, 0x6c,
+0x5e, 0xd2, 0xc1, 0x4d, 0xe7, 0x6b, 0x78, 0xf4, 0xab, 0x27, 0x34, 0xb8, 0x12, 0x9e, 0x8d, 0x01,
+0xe9, 0x65, 0x76, 0xfa, 0x50, 0xdc, 0xcf, 0x43, 0x1c, 0x90, 0x83, 0x0f, 0xa5, 0x29, 0x3a, 0xb6,
+0x84, 0x08, 0x1b, 0x97, 0x3d, 0xb1, 0xa2, 0x2e, 0x71, 0xfd, 0xee, 0x62, 0xc8, 0x44, 0x57, 0xdb,
+0x66, 0xea, 0xf9, 0x75, 0xdf, 0x53, 0x40, 0xcc, 0x93, 0x1f, 0x0c, 0x80, 0x2a, 0xa6, 0xb5, 0x39,
+0x0b, 0x87, 0x94, 0x18, 0xb2, 0x3e, 0x2d, 0xa1, 0xfe, 0x72, 0x61, 0xed, 0x47, 0xcb, 0xd8, 0x54,
+0xbc, 0x30, 0x23, 0xaf, 0x05, 0x89, 0x9a, 0x16, 0x49, 0xc5, 0xd6, 0x5a, 0xf0, 0x7c, 0x6f, 0xe3,
+0xd1, 0x5d, 0x4e, 0xc2, 0x68, 0xe4, 0xf7, 0x7b, 0x24, 0xa8, 0xbb, 0x37, 0x9d, 0x11, 0x02, 0x8e,
+0x55, 0xd9, 0xca, 0x46, 0xec, 0x60, 0x73, 0xff, 0xa0, 0x2c, 0x3f, 0xb3, 0x19, 0x95, 0x86, 0x0a,
+0x38, 0xb4, 0xa7, 0x2b, 0x81, 0x0d, 0x1e, 0x92, 0xcd, 0x41, 0x52, 0xde, 0x74, 0xf8, 0xeb, 0x67,
+0x8f, 0x03, 0x10, 0x9c, 0x36, 0xba, 0xa9, 0x25, 0x7a, 0xf6, 0xe5, 0x69, 0xc3, 0x4f, 0x5c, 0xd0,
+0xe2, 0x6e, 0x7d, 0xf1, 0x5b, 0xd7, 0xc4, 0x48, 0x17, 0x9b, 0x88, 0x04, 0xae, 0x22, 0x31, 0xbd,
+},
+{
+0x00, 0x7c, 0xf8, 0x84, 0x77, 0x0b, 0x8f, 0xf3, 0xee, 0x92, 0x16, 0x6a, 0x99, 0xe5, 0x61, 0x1d,
+0x5b, 0x27, 0xa3, 0xdf, 0x2c, 0x50, 0xd4, 0xa8, 0xb5, 0xc9, 0x4d, 0x31, 0xc2, 0xbe, 0x3a, 0x46,
+0xb6, 0xca, 0x4e, 0x32, 0xc1, 0xbd, 0x39, 0x45, 0x58, 0x24, 0xa0, 0xdc, 0x2f, 0x53, 0xd7, 0xab,
+0xed, 0x91, 0x15, 0x69, 0x9a, 0xe6, 0x62, 0x1e, 0x03, 0x7f, 0xfb, 0x87, 0x74, 0x08, 0x8c, 0xf0,
+0xeb, 0x97, 0x13, 0x6f, 0x9c, 0xe0, 0x64, 0x18, 0x05, 0x79, 0xfd, 0x81, 0x72, 0x0e, 0x8a, 0xf6,
+0xb0, 0xcc, 0x48, 0x34, 0xc7, 0xbb, 0x3f, 0x43, 0x5e, 0x22, 0xa6, 0xda, 0x29, 0x55, 0xd1, 0xad,
+0x5d, 0x21, 0xa5, 0xd9, 0x2a, 0x56, 0xd2, 0xae, 0xb3, 0xcf, 0x4b, 0x37, 0xc4, 0xb8, 0x3c, 0x40,
+0x06, 0x7a, 0xfe, 0x82, 0x71, 0x0d, 0x89, 0xf5, 0xe8, 0x94, 0x10, 0x6c, 0x9f, 0xe3, 0x67, 0x1b,
+0x51, 0x2d, 0xa9, 0xd5, 0x26, 0x5a, 0xde, 0xa2, 0xbf, 0xc3, 0x47, 0x3b, 0xc8, 0xb4, 0x30, 0x4c,
+0x0a, 0x76, 0xf2, 0x8e, 0x7d, 0x01, 0x85, 0xf9, 0xe4, 0x98, 0x1c, 0x60, 0x93, 0xef, 0x6b, 0x17,
+0xe7, 0x9b, 0x1f, 0x63, 0x90, 0xec, 0x68, 0x14, 0x09, 0x75, 0xf1, 0x8d, 0x7e, 0x02, 0x86, 0xfa,
+0xbc, 0xc0, 0x44, 0x38, 0xcb, 0xb7, 0x33, 0x4f, 0x52, 0x2e, 0xaa, 0xd6, 0x25, 0x59, 0xdd, 0xa1,
+0xba, 0xc6, 0x42, 0x3e, 0xcd, 0xb1, 0x35, 0x49, 0x54, 0x28, 0xac, 0xd0, 0x23, 0x5f, 0xdb, 0xa7,
+0xe1, 0x9d, 0x19, 0x65, 0x96, 0xea, 0x6e, 0x12, 0x0f, 0x73, 0xf7, 0x8b, 0x78, 0x04, 0x80, 0xfc,
+0x0c, 0x70, 0xf4, 0x88, 0x7b, 0x07, 0x83, 0xff, 0xe2, 0x9e, 0x1a, 0x66, 0x95, 0xe9, 0x6d, 0x11,
+0x57, 0x2b, 0xaf, 0xd3, 0x20, 0x5c, 0xd8, 0xa4, 0xb9, 0xc5, 0x41, 0x3d, 0xce, 0xb2, 0x36, 0x4a,
+},
+{
+0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e,
+0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30, 0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3e,
+0x40, 0x42, 0x44, 0x46, 0x48, 0x4a, 0x4c, 0x4e, 0x50, 0x52, 0x54, 0x56, 0x58, 0x5a, 0x5c, 0x5e,
+0x60, 0x62, 0x64, 0x66, 0x68, 0x6a, 0x6c, 0x6e, 0x70, 0x72, 0x74, 0x76, 0x78, 0x7a, 0x7c, 0x7e,
+0x80, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x92, 0x94, 0x96, 0x98, 0x9a, 0x9c, 0x9e,
+0xa0, 0xa2, 0xa4, 0xa6, 0xa8, 0xaa, 0xac, 0xae, 0xb0, 0xb2, 0xb4, 0xb6, 0xb8, 0xba, 0xbc, 0xbe,
+0xc0, 0xc2, 0xc4, 0xc6, 0xc8, 0xca, 0xcc, 0xce, 0xd0, 0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 0xde,
+0xe0, 0xe2, 0xe4, 0xe6, 0xe8, 0xea, 0xec, 0xee, 0xf0, 0xf2, 0xf4, 0xf6, 0xf8, 0xfa, 0xfc, 0xfe,
+0x87, 0x85, 0x83, 0x81, 0x8f, 0x8d, 0x8b, 0x89, 0x97, 0x95, 0x93, 0x91, 0x9f, 0x9d, 0x9b, 0x99,
+0xa7, 0xa5, 0xa3, 0xa1, 0xaf, 0xad, 0xab, 0xa9, 0xb7, 0xb5, 0xb3, 0xb1, 0xbf, 0xbd, 0xbb, 0xb9,
+0xc7, 0xc5, 0xc3, 0xc1, 0xcf, 0xcd, 0xcb, 0xc9, 0xd7, 0xd5, 0xd3, 0xd1, 0xdf, 0xdd, 0xdb, 0xd9,
+0xe7, 0xe5, 0xe3, 0xe1, 0xef, 0xed, 0xeb, 0xe9, 0xf7, 0xf5, 0xf3, 0xf1, 0xff, 0xfd, 0xfb, 0xf9,
+0x07, 0x05, 0x03, 0x01, 0x0f, 0x0d, 0x0b, 0x09, 0x17, 0x15, 0x13, 0x11, 0x1f, 0x1d, 0x1b, 0x19,
+0x27, 0x25, 0x23, 0x21, 0x2f, 0x2d, 0x2b, 0x29, 0x37, 0x35, 0x33, 0x31, 0x3f, 0x3d, 0x3b, 0x39,
+0x47, 0x45, 0x43, 0x41, 0x4f, 0x4d, 0x4b, 0x49, 0x57, 0x55, 0x53, 0x51, 0x5f, 0x5d, 0x5b, 0x59,
+0x67, 0x65, 0x63, 0x61, 0x6f, 0x6d, 0x6b, 0x69, 0x77, 0x75, 0x73, 0x71, 0x7f, 0x7d, 0x7b, 0x79,
+},
+{
+0x00, 0xdd, 0x3d, 0xe0, 0x7a, 0xa7, 0x47, 0x9a, 0xf4, 0x29, 0xc9, 0x14, 0x8e, 0x53, 0xb3, 0x6e,
+0x6f, 0xb2, 0x52, 0x8f, 0x15, 0xc8, 0x28, 0xf5, 0x9b, 0x46, 0xa6, 0x7b, 0xe1, 0x3c, 0xdc, 0x01,
+0xde, 0x03, 0xe3, 0x3e, 0xa4, 0x79, 0x99, 0x44, 0x2a, 0xf7, 0x17, 0xca, 0x50, 0x8d, 0x6d, 0xb0,
+0xb1, 0x6c, 0x8c, 0x51, 0xcb, 0x16, 0xf6, 0x2b, 0x45, 0x98, 0x78, 0xa5, 0x3f, 0xe2, 0x02, 0xdf,
+0x3b, 0xe6, 0x06, 0xdb, 0x41, 0x9c, 0x7c, 0xa1, 0xcf, 0x12, 0xf2, 0x2f, 0xb5, 0x68, 0x88, 0x55,
+0x54, 0x89, 0x69, 0xb4, 0x2e, 0xf3, 0x13, 0xce, 0xa0, 0x7d, 0x9d, 0x40, 0xda, 0x07, 0xe7, 0x3a,
+0xe5, 0x38, 0xd8, 0x05, 0x9f, 0x42, 0xa2, 0x7f, 0x11, 0xcc, 0x2c, 0xf1, 0x6b, 0xb6, 0x56, 0x8b,
+0x8a, 0x57, 0xb7, 0x6a, 0xf0, 0x2d, 0xcd, 0x10, 0x7e, 0xa3, 0x43, 0x9e, 0x04, 0xd9, 0x39, 0xe4,
+0x76, 0xab, 0x4b, 0x96, 0x0c, 0xd1, 0x31, 0xec, 0x82, 0x5f, 0xbf, 0x62, 0xf8, 0x25, 0xc5, 0x18,
+0x19, 0xc4, 0x24, 0xf9, 0x63, 0xbe, 0x5e, 0x83, 0xed, 0x30, 0xd0, 0x0d, 0x97, 0x4a, 0xaa, 0x77,
+0xa8, 0x75, 0x95, 0x48, 0xd2, 0x0f, 0xef, 0x32, 0x5c, 0x81, 0x61, 0xbc, 0x26, 0xfb, 0x1b, 0xc6,
+0xc7, 0x1a, 0xfa, 0x27, 0xbd, 0x60, 0x80, 0x5d, 0x33, 0xee, 0x0e, 0xd3, 0x49, 0x94, 0x74, 0xa9,
+0x4d, 0x90, 0x70, 0xad, 0x37, 0xea, 0x0a, 0xd7, 0xb9, 0x64, 0x84, 0x59, 0xc3, 0x1e, 0xfe, 0x23,
+0x22, 0xff, 0x1f, 0xc2, 0x58, 0x85, 0x65, 0xb8, 0xd6, 0x0b, 0xeb, 0x36, 0xac, 0x71, 0x91, 0x4c,
+0x93, 0x4e, 0xae, 0x73, 0xe9, 0x34, 0xd4, 0x09, 0x67, 0xba, 0x5a, 0x87, 0x1d, 0xc0, 0x20, 0xfd,
+0xfc, 0x21, 0xc1, 0x1c, 0x86, 0x5b, 0xbb, 0x66, 0x08, 0xd5, 0x35, 0xe8, 0x72, 0xaf, 0x4f, 0x92,
+},
+{
+0x00, 0xfb, 0x71, 0x8a, 0xe2, 0x19, 0x93, 0x68, 0x43, 0xb8, 0x32, 0xc9, 0xa1, 0x5a, 0xd0, 0x2b,
+0x86, 0x7d, 0xf7, 0x0c, 0x64, 0x9f, 0x15, 0xee, 0xc5, 0x3e, 0xb4, 0x4f, 0x27, 0xdc, 0x56, 0xad,
+0x8b, 0x70, 0xfa, 0x01, 0x69, 0x92, 0x18, 0xe3, 0xc8, 0x33, 0xb9, 0x42, 0x2a, 0xd1, 0x5b, 0xa0,
+0x0d, 0xf6, 0x7c, 0x87, 0xef, 0x14, 0x9e, 0x65, 0x4e, 0xb5, 0x3f, 0xc4, 0xac, 0x57, 0xdd, 0x26,
+0x91, 0x6a, 0xe0, 0x1b, 0x73, 0x88, 0x02, 0xf9, 0xd2, 0x29, 0xa3, 0x58, 0x30, 0xcb, 0x41, 0xba,
+0x17, 0xec, 0x66, 0x9d, 0xf5, 0x0e, 0x84, 0x7f, 0x54, 0xaf, 0x25, 0xde, 0xb6, 0x4d, 0xc7, 0x3c,
+0x1a, 0xe1, 0x6b, 0x90, 0xf8, 0x03, 0x89, 0x72, 0x59, 0xa2, 0x28, 0xd3, 0xbb, 0x40, 0xca, 0x31,
+0x9c, 0x67, 0xed, 0x16, 0x7e, 0x85, 0x0f, 0xf4, 0xdf, 0x24, 0xae, 0x55, 0x3d, 0xc6, 0x4c, 0xb7,
+0xa5, 0x5e, 0xd4, 0x2f, 0x47, 0xbc, 0x36, 0xcd, 0xe6, 0x1d, 0x97, 0x6c, 0x04, 0xff, 0x75, 0x8e,
+0x23, 0xd8, 0x52, 0xa9, 0xc1, 0x3a, 0xb0, 0x4b, 0x60, 0x9b, 0x11, 0xea, 0x82, 0x79, 0xf3, 0x08,
+0x2e, 0xd5, 0x5f, 0xa4, 0xcc, 0x37, 0xbd, 0x46, 0x6d, 0x96, 0x1c, 0xe7, 0x8f, 0x74, 0xfe, 0x05,
+0xa8, 0x53, 0xd9, 0x22, 0x4a, 0xb1, 0x3b, 0xc0, 0xeb, 0x10, 0x9a, 0x61, 0x09, 0xf2, 0x78, 0x83,
+0x34, 0xcf, 0x45, 0xbe, 0xd6, 0x2d, 0xa7, 0x5c, 0x77, 0x8c, 0x06, 0xfd, 0x95, 0x6e, 0xe4, 0x1f,
+0xb2, 0x49, 0xc3, 0x38, 0x50, 0xab, 0x21, 0xda, 0xf1, 0x0a, 0x80, 0x7b, 0x13, 0xe8, 0x62, 0x99,
+0xbf, 0x44, 0xce, 0x35, 0x5d, 0xa6, 0x2c, 0xd7, 0xfc, 0x07, 0x8d, 0x76, 0x1e, 0xe5, 0x6f, 0x94,
+0x39, 0xc2, 0x48, 0xb3, 0xdb, 0x20, 0xaa, 0x51, 0x7a, 0x81, 0x0b, 0xf0, 0x98, 0x63, 0xe9, 0x12,
+},
+{
+0x00, 0x74, 0xe8, 0x9c, 0x57, 0x23, 0xbf, 0xcb, 0xae, 0xda, 0x46, 0x32, 0xf9, 0x8d, 0x11, 0x65,
+0xdb, 0xaf, 0x33, 0x47, 0x8c, 0xf8, 0x64, 0x10, 0x75, 0x01, 0x9d, 0xe9, 0x22, 0x56, 0xca, 0xbe,
+0x31, 0x45, 0xd9, 0xad, 0x66, 0x12, 0x8e, 0xfa, 0x9f, 0xeb, 0x77, 0x03, 0xc8, 0xbc, 0x20, 0x54,
+0xea, 0x9e, 0x02, 0x76, 0xbd, 0xc9, 0x55, 0x21, 0x44, 0x30, 0xac, 0xd8, 0x13, 0x67, 0xfb, 0x8f,
+0x62, 0x16, 0x8a, 0xfe, 0x35, 0x41, 0xdd, 0xa9, 0xcc, 0xb8, 0x24, 0x50, 0x9b, 0xef, 0x73, 0x07,
+0xb9, 0xcd, 0x51, 0x25, 0xee, 0x9a, 0x06, 0x72, 0x17, 0x63, 0xff, 0x8b, 0x40, 0x34, 0xa8, 0xdc,
+0x53, 0x27, 0xbb, 0xcf, 0x04, 0x70, 0xec, 0x98, 0xfd, 0x89, 0x15, 0x61, 0xaa, 0xde, 0x42, 0x36,
+0x88, 0xfc, 0x60, 0x14, 0xdf, 0xab, 0x37, 0x43, 0x26, 0x52, 0xce, 0xba, 0x71, 0x05, 0x99, 0xed,
+0xc4, 0xb0, 0x2c, 0x58, 0x93, 0xe7, 0x7b, 0x0f, 0x6a, 0x1e, 0x82, 0xf6, 0x3d, 0x49, 0xd5, 0xa1,
+0x1f, 0x6b, 0xf7, 0x83, 0x48, 0x3c, 0xa0, 0xd4, 0xb1, 0xc5, 0x59, 0x2d, 0xe6, 0x92, 0x0e, 0x7a,
+0xf5, 0x81, 0x1d, 0x69, 0xa2, 0xd6, 0x4a, 0x3e, 0x5b, 0x2f, 0xb3, 0xc7, 0x0c, 0x78, 0xe4, 0x90,
+0x2e, 0x5a, 0xc6, 0xb2, 0x79, 0x0d, 0x91, 0xe5, 0x80, 0xf4, 0x68, 0x1c, 0xd7, 0xa3, 0x3f, 0x4b,
+0xa6, 0xd2, 0x4e, 0x3a, 0xf1, 0x85, 0x19, 0x6d, 0x08, 0x7c, 0xe0, 0x94, 0x5f, 0x2b, 0xb7, 0xc3,
+0x7d, 0x09, 0x95, 0xe1, 0x2a, 0x5e, 0xc2, 0xb6, 0xd3, 0xa7, 0x3b, 0x4f, 0x84, 0xf0, 0x6c, 0x18,
+0x97, 0xe3, 0x7f, 0x0b, 0xc0, 0xb4, 0x28, 0x5c, 0x39, 0x4d, 0xd1, 0xa5, 0x6e, 0x1a, 0x86, 0xf2,
+0x4c, 0x38, 0xa4, 0xd0, 0x1b, 0x6f, 0xf3, 0x87, 0xe2, 0x96, 0x0a, 0x7e, 0xb5, 0xc1, 0x5d, 0x29,
+},
+{
+0x00, 0x78, 0xf0, 0x88, 0x67, 0x1f, 0x97, 0xef, 0xce, 0xb6, 0x3e, 0x46, 0xa9, 0xd1, 0x59, 0x21,
+0x1b, 0x63, 0xeb, 0x93, 0x7c, 0x04, 0x8c, 0xf4, 0xd5, 0xad, 0x25, 0x5d, 0xb2, 0xca, 0x42, 0x3a,
+0x36, 0x4e, 0xc6, 0xbe, 0x51, 0x29, 0xa1, 0xd9, 0xf8, 0x80, 0x08, 0x70, 0x9f, 0xe7, 0x6f, 0x17,
+0x2d, 0x55, 0xdd, 0xa5, 0x4a, 0x32, 0xba, 0xc2, 0xe3, 0x9b, 0x13, 0x6b, 0x84, 0xfc, 0x74, 0x0c,
+0x6c, 0x14, 0x9c, 0xe4, 0x0b, 0x73, 0xfb, 0x83, 0xa2, 0xda, 0x52, 0x2a, 0xc5, 0xbd, 0x35, 0x4d,
+0x77, 0x0f, 0x87, 0xff, 0x10, 0x68, 0xe0, 0x98, 0xb9, 0xc1, 0x49, 0x31, 0xde, 0xa6, 0x2e, 0x56,
+0x5a, 0x22, 0xaa, 0xd2, 0x3d, 0x45, 0xcd, 0xb5, 0x94, 0xec, 0x64, 0x1c, 0xf3, 0x8b, 0x03, 0x7b,
+0x41, 0x39, 0xb1, 0xc9, 0x26, 0x5e, 0xd6, 0xae, 0x8f, 0xf7, 0x7f, 0x07, 0xe8, 0x90, 0x18, 0x60,
+0xd8, 0xa0, 0x28, 0x50, 0xbf, 0xc7, 0x4f, 0x37, 0x16, 0x6e, 0xe6, 0x9e, 0x71, 0x09, 0x81, 0xf9,
+0xc3, 0xbb, 0x33, 0x4b, 0xa4, 0xdc, 0x54, 0x2c, 0x0d, 0x75, 0xfd, 0x85, 0x6a, 0x12, 0x9a, 0xe2,
+0xee, 0x96, 0x1e, 0x66, 0x89, 0xf1, 0x79, 0x01, 0x20, 0x58, 0xd0, 0xa8, 0x47, 0x3f, 0xb7, 0xcf,
+0xf5, 0x8d, 0x05, 0x7d, 0x92, 0xea, 0x62, 0x1a, 0x3b, 0x43, 0xcb, 0xb3, 0x5c, 0x24, 0xac, 0xd4,
+0xb4, 0xcc, 0x44, 0x3c, 0xd3, 0xab, 0x23, 0x5b, 0x7a, 0x02, 0x8a, 0xf2, 0x1d, 0x65, 0xed, 0x95,
+0xaf, 0xd7, 0x5f, 0x27, 0xc8, 0xb0, 0x38, 0x40, 0x61, 0x19, 0x91, 0xe9, 0x06, 0x7e, 0xf6, 0x8e,
+0x82, 0xfa, 0x72, 0x0a, 0xe5, 0x9d, 0x15, 0x6d, 0x4c, 0x34, 0xbc, 0xc4, 0x2b, 0x53, 0xdb, 0xa3,
+0x99, 0xe1, 0x69, 0x11, 0xfe, 0x86, 0x0e, 0x76, 0x57, 0x2f, 0xa7, 0xdf, 0x30, 0x48, 0xc0, 0xb8,
+},
+{
+0x00, 0x3f, 0x7e, 0x41, 0xfc, 0xc3, 0x82, 0xbd, 0x7f, 0x40, 0x01, 0x3e, 0x83, 0xbc, 0xfd, 0xc2,
+0xfe, 0xc1, 0x80, 0xbf, 0x02, 0x3d, 0x7c, 0x43, 0x81, 0xbe, 0xff, 0xc0, 0x7d, 0x42, 0x03, 0x3c,
+0x7b, 0x44, 0x05, 0x3a, 0x87, 0xb8, 0xf9, 0xc6, 0x04, 0x3b, 0x7a, 0x45, 0xf8, 0xc7, 0x86, 0xb9,
+0x85, 0xba, 0xfb, 0xc4, 0x79, 0x46, 0x07, 0x38, 0xfa, 0xc5, 0x84, 0xbb, 0x06, 0x39, 0x78, 0x47,
+0xf6, 0xc9, 0x88, 0xb7, 0x0a, 0x35, 0x74, 0x4b, 0x89, 0xb6, 0xf7, 0xc8, 0x75, 0x4a, 0x0b, 0x34,
+0x08, 0x37, 0x76, 0x49, 0xf4, 0xcb, 0x8a, 0xb5, 0x77, 0x48, 0x09, 0x36, 0x8b, 0xb4, 0xf5, 0xca,
+0x8d, 0xb2, 0xf3, 0xcc, 0x71, 0x4e, 0x0f, 0x30, 0xf2, 0xcd, 0x8c, 0xb3, 0x0e, 0x31, 0x70, 0x4f,
+0x73, 0x4c, 0x0d, 0x32, 0x8f, 0xb0, 0xf1, 0xce, 0x0c, 0x33, 0x72, 0x4d, 0xf0, 0xcf, 0x8e, 0xb1,
+0x6b, 0x54, 0x15, 0x2a, 0x97, 0xa8, 0xe9, 0xd6, 0x14, 0x2b, 0x6a, 0x55, 0xe8, 0xd7, 0x96, 0xa9,
+0x95, 0xaa, 0xeb, 0xd4, 0x69, 0x56, 0x17, 0x28, 0xea, 0xd5, 0x94, 0xab, 0x16, 0x29, 0x68, 0x57,
+0x10, 0x2f, 0x6e, 0x51, 0xec, 0xd3, 0x92, 0xad, 0x6f, 0x50, 0x11, 0x2e, 0x93, 0xac, 0xed, 0xd2,
+0xee, 0xd1, 0x90, 0xaf, 0x12, 0x2d, 0x6c, 0x53, 0x91, 0xae, 0xef, 0xd0, 0x6d, 0x52, 0x13, 0x2c,
+0x9d, 0xa2, 0xe3, 0xdc, 0x61, 0x5e, 0x1f, 0x20, 0xe2, 0xdd, 0x9c, 0xa3, 0x1e, 0x21, 0x60, 0x5f,
+0x63, 0x5c, 0x1d, 0x22, 0x9f, 0xa0, 0xe1, 0xde, 0x1c, 0x23, 0x62, 0x5d, 0xe0, 0xdf, 0x9e, 0xa1,
+0xe6, 0xd9, 0x98, 0xa7, 0x1a, 0x25, 0x64, 0x5b, 0x99, 0xa6, 0xe7, 0xd8, 0x65, 0x5a, 0x1b, 0x24,
+0x18, 0x27, 0x66, 0x59, 0xe4, 0xdb, 0x9a, 0xa5, 0x67, 0x58, 0x19, 0x26, 0x9b, 0xa4, 0xe5, 0xda,
+},
+{
+0x00, 0xac, 0xdf, 0x73, 0x39, 0x95, 0xe6, 0x4a, 0x72, 0xde, 0xad, 0x01, 0x4b, 0xe7, 0x94, 0x38,
+0xe4, 0x48, 0x3b, 0x97, 0xdd, 0x71, 0x02, 0xae, 0x96, 0x3a, 0x49, 0xe5, 0xaf, 0x03, 0x70, 0xdc,
+0x4f, 0xe3, 0x90, 0x3c, 0x76, 0xda, 0xa9, 0x05, 0x3d, 0x91, 0xe2, 0x4e, 0x04, 0xa8, 0xdb, 0x77,
+0xab, 0x07, 0x74, 0xd8, 0x92, 0x3e, 0x4d, 0xe1, 0xd9, 0x75, 0x06, 0xaa, 0xe0, 0x4c, 0x3f, 0x93,
+0x9e, 0x32, 0x41, 0xed, 0xa7, 0x0b, 0x78, 0xd4, 0xec, 0x40, 0x33, 0x9f, 0xd5, 0x79, 0x0a, 0xa6,
+0x7a, 0xd6, 0xa5, 0x09, 0x43, 0xef, 0x9c, 0x30, 0x08, 0xa4, 0xd7, 0x7b, 0x31, 0x9d, 0xee, 0x42,
+0xd1, 0x7d, 0x0e, 0xa2, 0xe8, 0x44, 0x37, 0x9b, 0xa3, 0x0f, 0x7c, 0xd0, 0x9a, 0x36, 0x45, 0xe9,
+0x35, 0x99, 0xea, 0x46, 0x0c, 0xa0, 0xd3, 0x7f, 0x47, 0xeb, 0x98, 0x34, 0x7e, 0xd2, 0xa1, 0x0d,
+0xbb, 0x17, 0x64, 0xc8, 0x82, 0x2e, 0x5d, 0xf1, 0xc9, 0x65, 0x16, 0xba, 0xf0, 0x5c, 0x2f, 0x83,
+0x5f, 0xf3, 0x80, 0x2c, 0x66, 0xca, 0xb9, 0x15, 0x2d, 0x81, 0xf2, 0x5e, 0x14, 0xb8, 0xcb, 0x67,
+0xf4, 0x58, 0x2b, 0x87, 0xcd, 0x61, 0x12, 0xbe, 0x86, 0x2a, 0x59, 0xf5, 0xbf, 0x13, 0x60, 0xcc,
+0x10, 0xbc, 0xcf, 0x63, 0x29, 0x85, 0xf6, 0x5a, 0x62, 0xce, 0xbd, 0x11, 0x5b, 0xf7, 0x84, 0x28,
+0x25, 0x89, 0xfa, 0x56, 0x1c, 0xb0, 0xc3, 0x6f, 0x57, 0xfb, 0x88, 0x24, 0x6e, 0xc2, 0xb1, 0x1d,
+0xc1, 0x6d, 0x1e, 0xb2, 0xf8, 0x54, 0x27, 0x8b, 0xb3, 0x1f, 0x6c, 0xc0, 0x8a, 0x26, 0x55, 0xf9,
+0x6a, 0xc6, 0xb5, 0x19, 0x53, 0xff, 0x8c, 0x20, 0x18, 0xb4, 0xc7, 0x6b, 0x21, 0x8d, 0xfe, 0x52,
+0x8e, 0x22, 0x51, 0xfd, 0xb7, 0x1b, 0x68, 0xc4, 0xfc, 0x50, 0x23, 0x8f, 0xc5, 0x69, 0x1a, 0xb6,
+},
+{
+0x00, 0x13, 0x26, 0x35, 0x4c, 0x5f, 0x6a, 0x79, 0x98, 0x8b, 0xbe, 0xad, 0xd4, 0xc7, 0xf2, 0xe1,
+0xb7, 0xa4, 0x91, 0x82, 0xfb, 0xe8, 0xdd, 0xce, 0x2f, 0x3c, 0x09, 0x1a, 0x63, 0x70, 0x45, 0x56,
+0xe9, 0xfa, 0xcf, 0xdc, 0xa5, 0xb6, 0x83, 0x90, 0x71, 0x62, 0x57, 0x44, 0x3d, 0x2e, 0x1b, 0x08,
+0x5e, 0x4d, 0x78, 0x6b, 0x12, 0x01, 0x34, 0x27, 0xc6, 0xd5, 0xe0, 0xf3, 0x8a, 0x99, 0xac, 0xbf,
+0x55, 0x46, 0x73, 0x60, 0x19, 0x0a, 0x3f, 0x2c, 0xcd, 0xde, 0xeb, 0xf8, 0x81, 0x92, 0xa7, 0xb4,
+0xe2, 0xf1, 0xc4, 0xd7, 0xae, 0xbd, 0x88, 0x9b, 0x7a, 0x69, 0x5c, 0x4f, 0x36, 0x25, 0x10, 0x03,
+0xbc, 0xaf, 0x9a, 0x89, 0xf0, 0xe3, 0xd6, 0xc5, 0x24, 0x37, 0x02, 0x11, 0x68, 0x7b, 0x4e, 0x5d,
+0x0b, 0x18, 0x2d, 0x3e, 0x47, 0x54, 0x61, 0x72, 0x93, 0x80, 0xb5, 0xa6, 0xdf, 0xcc, 0xf9, 0xea,
+0xaa, 0xb9, 0x8c, 0x9f, 0xe6, 0xf5, 0xc0, 0xd3, 0x32, 0x21, 0x14, 0x07, 0x7e, 0x6d, 0x58, 0x4b,
+0x1d, 0x0e, 0x3b, 0x28, 0x51, 0x42, 0x77, 0x64, 0x85, 0x96, 0xa3, 0xb0, 0xc9, 0xda, 0xef, 0xfc,
+0x43, 0x50, 0x65, 0x76, 0x0f, 0x1c, 0x29, 0x3a, 0xdb, 0xc8, 0xfd, 0xee, 0x97, 0x84, 0xb1, 0xa2,
+0xf4, 0xe7, 0xd2, 0xc1, 0xb8, 0xab, 0x9e, 0x8d, 0x6c, 0x7f, 0x4a, 0x59, 0x20, 0x33, 0x06, 0x15,
+0xff, 0xec, 0xd9, 0xca, 0xb3, 0xa0, 0x95, 0x86, 0x67, 0x74, 0x41, 0x52, 0x2b, 0x38, 0x0d, 0x1e,
+0x48, 0x5b, 0x6e, 0x7d, 0x04, 0x17, 0x22, 0x31, 0xd0, 0xc3, 0xf6, 0xe5, 0x9c, 0x8f, 0xba, 0xa9,
+0x16, 0x05, 0x30, 0x23, 0x5a, 0x49, 0x7c, 0x6f, 0x8e, 0x9d, 0xa8, 0xbb, 0xc2, 0xd1, 0xe4, 0xf7,
+0xa1, 0xb2, 0x87, 0x94, 0xed, 0xfe, 0xcb, 0xd8, 0x39, 0x2a, 0x1f, 0x0c, 0x75, 0x66, 0x53, 0x40,
+},
+{
+0x00, 0x84, 0x8f, 0x0b, 0x99, 0x1d, 0x16, 0x92, 0xb5, 0x31, 0x3a, 0xbe, 0x2c, 0xa8, 0xa3, 0x27,
+0xed, 0x69, 0x62, 0xe6, 0x74, 0xf0, 0xfb, 0x7f, 0x58, 0xdc, 0xd7, 0x53, 0xc1, 0x45, 0x4e, 0xca,
+0x5d, 0xd9, 0xd2, 0x56, 0xc4, 0x40, 0x4b, 0xcf, 0xe8, 0x6c, 0x67, 0xe3, 0x71, 0xf5, 0xfe, 0x7a,
+0xb0, 0x34, 0x3f, 0xbb, 0x29, 0xad, 0xa6, 0x22, 0x05, 0x81, 0x8a, 0x0e, 0x9c, 0x18, 0x13, 0x97,
+0xba, 0x3e, 0x35, 0xb1, 0x23, 0xa7, 0xac, 0x28, 0x0f, 0x8b, 0x80, 0x04, 0x96, 0x12, 0x19, 0x9d,
+0x57, 0xd3, 0xd8, 0x5c, 0xce, 0x4a, 0x41, 0xc5, 0xe2, 0x66, 0x6d, 0xe9, 0x7b, 0xff, 0xf4, 0x70,
+0xe7, 0x63, 0x68, 0xec, 0x7e, 0xfa, 0xf1, 0x75, 0x52, 0xd6, 0xdd, 0x59, 0xcb, 0x4f, 0x44, 0xc0,
+0x0a, 0x8e, 0x85, 0x01, 0x93, 0x17, 0x1c, 0x98, 0xbf, 0x3b, 0x30, 0xb4, 0x26, 0xa2, 0xa9, 0x2d,
+0xf3, 0x77, 0x7c, 0xf8, 0x6a, 0xee, 0xe5, 0x61, 0x46, 0xc2, 0xc9, 0x4d, 0xdf, 0x5b, 0x50, 0xd4,
+0x1e, 0x9a, 0x91, 0x15, 0x87, 0x03, 0x08, 0x8c, 0xab, 0x2f, 0x24, 0xa0, 0x32, 0xb6, 0xbd, 0x39,
+0xae, 0x2a, 0x21, 0xa5, 0x37, 0xb3, 0xb8, 0x3c, 0x1b, 0x9f, 0x94, 0x10, 0x82, 0x06, 0x0d, 0x89,
+0x43, 0xc7, 0xcc, 0x48, 0xda, 0x5e, 0x55, 0xd1, 0xf6, 0x72, 0x79, 0xfd, 0x6f, 0xeb, 0xe0, 0x64,
+0x49, 0xcd, 0xc6, 0x42, 0xd0, 0x54, 0x5f, 0xdb, 0xfc, 0x78, 0x73, 0xf7, 0x65, 0xe1, 0xea, 0x6e,
+0xa4, 0x20, 0x2b, 0xaf, 0x3d, 0xb9, 0xb2, 0x36, 0x11, 0x95, 0x9e, 0x1a, 0x88, 0x0c, 0x07, 0x83,
+0x14, 0x90, 0x9b, 0x1f, 0x8d, 0x09, 0x02, 0x86, 0xa1, 0x25, 0x2e, 0xaa, 0x38, 0xbc, 0xb7, 0x33,
+0xf9, 0x7d, 0x76, 0xf2, 0x60, 0xe4, 0xef, 0x6b, 0x4c, 0xc8, 0xc3, 0x47, 0xd5, 0x51, 0x5a, 0xde,
+},
+{
+0x00, 0x06, 0x0c, 0x0a, 0x18, 0x1e, 0x14, 0x12, 0x30, 0x36, 0x3c, 0x3a, 0x28, 0x2e, 0x24, 0x22,
+0x60, 0x66, 0x6c, 0x6a, 0x78, 0x7e, 0x74, 0x72, 0x50, 0x56, 0x5c, 0x5a, 0x48, 0x4e, 0x44, 0x42,
+0xc0, 0xc6, 0xcc, 0xca, 0xd8, 0xde, 0xd4, 0xd2, 0xf0, 0xf6, 0xfc, 0xfa, 0xe8, 0xee, 0xe4, 0xe2,
+0xa0, 0xa6, 0xac, 0xaa, 0xb8, 0xbe, 0xb4, 0xb2, 0x90, 0x96, 0x9c, 0x9a, 0x88, 0x8e, 0x84, 0x82,
+0x07, 0x01, 0x0b, 0x0d, 0x1f, 0x19, 0x13, 0x15, 0x37, 0x31, 0x3b, 0x3d, 0x2f, 0x29, 0x23, 0x25,
+0x67, 0x61, 0x6b, 0x6d, 0x7f, 0x79, 0x73, 0x75, 0x57, 0x51, 0x5b, 0x5d, 0x4f, 0x49, 0x43, 0x45,
+0xc7, 0xc1, 0xcb, 0xcd, 0xdf, 0xd9, 0xd3, 0xd5, 0xf7, 0xf1, 0xfb, 0xfd, 0xef, 0xe9, 0xe3, 0xe5,
+0xa7, 0xa1, 0xab, 0xad, 0xbf, 0xb9, 0xb3, 0xb5, 0x97, 0x91, 0x9b, 0x9d, 0x8f, 0x89, 0x83, 0x85,
+0x0e, 0x08, 0x02, 0x04, 0x16, 0x10, 0x1a, 0x1c, 0x3e, 0x38, 0x32, 0x34, 0x26, 0x20, 0x2a, 0x2c,
+0x6e, 0x68, 0x62, 0x64, 0x76, 0x70, 0x7a, 0x7c, 0x5e, 0x58, 0x52, 0x54, 0x46, 0x40, 0x4a, 0x4c,
+0xce, 0xc8, 0xc2, 0xc4, 0xd6, 0xd0, 0xda, 0xdc, 0xfe, 0xf8, 0xf2, 0xf4, 0xe6, 0xe0, 0xea, 0xec,
+0xae, 0xa8, 0xa2, 0xa4, 0xb6, 0xb0, 0xba, 0xbc, 0x9e, 0x98, 0x92, 0x94, 0x86, 0x80, 0x8a, 0x8c,
+0x09, 0x0f, 0x05, 0x03, 0x11, 0x17, 0x1d, 0x1b, 0x39, 0x3f, 0x35, 0x33, 0x21, 0x27, 0x2d, 0x2b,
+0x69, 0x6f, 0x65, 0x63, 0x71, 0x77, 0x7d, 0x7b, 0x59, 0x5f, 0x55, 0x53, 0x41, 0x47, 0x4d, 0x4b,
+0xc9, 0xcf, 0xc5, 0xc3, 0xd1, 0xd7, 0xdd, 0xdb, 0xf9, 0xff, 0xf5, 0xf3, 0xe1, 0xe7, 0xed, 0xeb,
+0xa9, 0xaf, 0xa5, 0xa3, 0xb1, 0xb7, 0xbd, 0xbb, 0x99, 0x9f, 0x95, 0x93, 0x81, 0x87, 0x8d, 0x8b,
+},
+{
+0x00, 0xe0, 0x47, 0xa7, 0x8e, 0x6e, 0xc9, 0x29, 0x9b, 0x7b, 0xdc, 0x3c, 0x15, 0xf5, 0x52, 0xb2,
+0xb1, 0x51, 0xf6, 0x16, 0x3f, 0xdf, 0x78, 0x98, 0x2a, 0xca, 0x6d, 0x8d, 0xa4, 0x44, 0xe3, 0x03,
+0xe5, 0x05, 0xa2, 0x42, 0x6b, 0x8b, 0x2c, 0xcc, 0x7e, 0x9e, 0x39, 0xd9, 0xf0, 0x10, 0xb7, 0x57,
+0x54, 0xb4, 0x13, 0xf3, 0xda, 0x3a, 0x9d, 0x7d, 0xcf, 0x2f, 0x88, 0x68, 0x41, 0xa1, 0x06, 0xe6,
+0x4d, 0xad, 0x0a, 0xea, 0xc3, 0x23, 0x84, 0x64, 0xd6, 0x36, 0x91, 0x71, 0x58, 0xb8, 0x1f, 0xff,
+0xfc, 0x1c, 0xbb, 0x5b, 0x72, 0x92, 0x35, 0xd5, 0x67, 0x87, 0x20, 0xc0, 0xe9, 0x09, 0xae, 0x4e,
+0xa8, 0x48, 0xef, 0x0f, 0x26, 0xc6, 0x61, 0x81, 0x33, 0xd3, 0x74, 0x94, 0xbd, 0x5d, 0xfa, 0x1a,
+0x19, 0xf9, 0x5e, 0xbe, 0x97, 0x77, 0xd0, 0x30, 0x82, 0x62, 0xc5, 0x25, 0x0c, 0xec, 0x4b, 0xab,
+0x9a, 0x7a, 0xdd, 0x3d, 0x14, 0xf4, 0x53, 0xb3, 0x01, 0xe1, 0x46, 0xa6, 0x8f, 0x6f, 0xc8, 0x28,
+0x2b, 0xcb, 0x6c, 0x8c, 0xa5, 0x45, 0xe2, 0x02, 0xb0, 0x50, 0xf7, 0x17, 0x3e, 0xde, 0x79, 0x99,
+0x7f, 0x9f, 0x38, 0xd8, 0xf1, 0x11, 0xb6, 0x56, 0xe4, 0x04, 0xa3, 0x43, 0x6a, 0x8a, 0x2d, 0xcd,
+0xce, 0x2e, 0x89, 0x69, 0x40, 0xa0, 0x07, 0xe7, 0x55, 0xb5, 0x12, 0xf2, 0xdb, 0x3b, 0x9c, 0x7c,
+0xd7, 0x37, 0x90, 0x70, 0x59, 0xb9, 0x1e, 0xfe, 0x4c, 0xac, 0x0b, 0xeb, 0xc2, 0x22, 0x85, 0x65,
+0x66, 0x86, 0x21, 0xc1, 0xe8, 0x08, 0xaf, 0x4f, 0xfd, 0x1d, 0xba, 0x5a, 0x73, 0x93, 0x34, 0xd4,
+0x32, 0xd2, 0x75, 0x95, 0xbc, 0x5c, 0xfb, 0x1b, 0xa9, 0x49, 0xee, 0x0e, 0x27, 0xc7, 0x60, 0x80,
+0x83, 0x63, 0xc4, 0x24, 0x0d, 0xed, 0x4a, 0xaa, 0x18, 0xf8, 0x5f, 0xbf, 0x96, 0x76, 0xd1, 0x31,
+},
+{
+0x00, 0x8a, 0x93, 0x19, 0xa1, 0x2b, 0x32, 0xb8, 0xc5, 0x4f, 0x56, 0xdc, 0x64, 0xee, 0xf7, 0x7d,
+0x0d, 0x87, 0x9e, 0x14, 0xac, 0x26, 0x3f, 0xb5, 0xc8, 0x42, 0x5b, 0xd1, 0x69, 0xe3, 0xfa, 0x70,
+0x1a, 0x90, 0x89, 0x03, 0xbb, 0x31, 0x28, 0xa2, 0xdf, 0x55, 0x4c, 0xc6, 0x7e, 0xf4, 0xed, 0x67,
+0x17, 0x9d, 0x84, 0x0e, 0xb6, 0x3c, 0x25, 0xaf, 0xd2, 0x58, 0x41, 0xcb, 0x73, 0xf9, 0xe0, 0x6a,
+0x34, 0xbe, 0xa7, 0x2d, 0x95, 0x1f, 0x06, 0x8c, 0xf1, 0x7b, 0x62, 0xe8, 0x50, 0xda, 0xc3, 0x49,
+0x39, 0xb3, 0xaa, 0x20, 0x98, 0x12, 0x0b, 0x81, 0xfc, 0x76, 0x6f, 0xe5, 0x5d, 0xd7, 0xce, 0x44,
+0x2e, 0xa4, 0xbd, 0x37, 0x8f, 0x05, 0x1c, 0x96, 0xeb, 0x61, 0x78, 0xf2, 0x4a, 0xc0, 0xd9, 0x53,
+0x23, 0xa9, 0xb0, 0x3a, 0x82, 0x08, 0x11, 0x9b, 0xe6, 0x6c, 0x75, 0xff, 0x47, 0xcd, 0xd4, 0x5e,
+0x68, 0xe2, 0xfb, 0x71, 0xc9, 0x43, 0x5a, 0xd0, 0xad, 0x27, 0x3e, 0xb4, 0x0c, 0x86, 0x9f, 0x15,
+0x65, 0xef, 0xf6, 0x7c, 0xc4, 0x4e, 0x57, 0xdd, 0xa0, 0x2a, 0x33, 0xb9, 0x01, 0x8b, 0x92, 0x18,
+0x72, 0xf8, 0xe1, 0x6b, 0xd3, 0x59, 0x40, 0xca, 0xb7, 0x3d, 0x24, 0xae, 0x16, 0x9c, 0x85, 0x0f,
+0x7f, 0xf5, 0xec, 0x66, 0xde, 0x54, 0x4d, 0xc7, 0xba, 0x30, 0x29, 0xa3, 0x1b, 0x91, 0x88, 0x02,
+0x5c, 0xd6, 0xcf, 0x45, 0xfd, 0x77, 0x6e, 0xe4, 0x99, 0x13, 0x0a, 0x80, 0x38, 0xb2, 0xab, 0x21,
+0x51, 0xdb, 0xc2, 0x48, 0xf0, 0x7a, 0x63, 0xe9, 0x94, 0x1e, 0x07, 0x8d, 0x35, 0xbf, 0xa6, 0x2c,
+0x46, 0xcc, 0xd5, 0x5f, 0xe7, 0x6d, 0x74, 0xfe, 0x83, 0x09, 0x10, 0x9a, 0x22, 0xa8, 0xb1, 0x3b,
+0x4b, 0xc1, 0xd8, 0x52, 0xea, 0x60, 0x79, 0xf3, 0x8e, 0x04, 0x1d, 0x97, 0x2f, 0xa5, 0xbc, 0x36,
+},
+{
+0x00, 0x9c, 0xbf, 0x23, 0xf9, 0x65, 0x46, 0xda, 0x75, 0xe9, 0xca, 0x56, 0x8c, 0x10, 0x33, 0xaf,
+0xea, 0x76, 0x55, 0xc9, 0x13, 0x8f, 0xac, 0x30, 0x9f, 0x03, 0x20, 0xbc, 0x66, 0xfa, 0xd9, 0x45,
+0x53, 0xcf, 0xec, 0x70, 0xaa, 0x36, 0x15, 0x89, 0x26, 0xba, 0x99, 0x05, 0xdf, 0x43, 0x60, 0xfc,
+0xb9, 0x25, 0x06, 0x9a, 0x40, 0xdc, 0xff, 0x63, 0xcc, 0x50, 0x73, 0xef, 0x35, 0xa9, 0x8a, 0x16,
+0xa6, 0x3a, 0x19, 0x85, 0x5f, 0xc3, 0xe0, 0x7c, 0xd3, 0x4f, 0x6c, 0xf0, 0x2a, 0xb6, 0x95, 0x09,
+0x4c, 0xd0, 0xf3, 0x6f, 0xb5, 0x29, 0x0a, 0x96, 0x39, 0xa5, 0x86, 0x1a, 0xc0, 0x5c, 0x7f, 0xe3,
+0xf5, 0x69, 0x4a, 0xd6, 0x0c, 0x90, 0xb3, 0x2f, 0x80, 0x1c, 0x3f, 0xa3, 0x79, 0xe5, 0xc6, 0x5a,
+0x1f, 0x83, 0xa0, 0x3c, 0xe6, 0x7a, 0x59, 0xc5, 0x6a, 0xf6, 0xd5, 0x49, 0x93, 0x0f, 0x2c, 0xb0,
+0xcb, 0x57, 0x74, 0xe8, 0x32, 0xae, 0x8d, 0x11, 0xbe, 0x22, 0x01, 0x9d, 0x47, 0xdb, 0xf8, 0x64,
+0x21, 0xbd, 0x9e, 0x02, 0xd8, 0x44, 0x67, 0xfb, 0x54, 0xc8, 0xeb, 0x77, 0xad, 0x31, 0x12, 0x8e,
+0x98, 0x04, 0x27, 0xbb, 0x61, 0xfd, 0xde, 0x42, 0xed, 0x71, 0x52, 0xce, 0x14, 0x88, 0xab, 0x37,
+0x72, 0xee, 0xcd, 0x51, 0x8b, 0x17, 0x34, 0xa8, 0x07, 0x9b, 0xb8, 0x24, 0xfe, 0x62, 0x41, 0xdd,
+0x6d, 0xf1, 0xd2, 0x4e, 0x94, 0x08, 0x2b, 0xb7, 0x18, 0x84, 0xa7, 0x3b, 0xe1, 0x7d, 0x5e, 0xc2,
+0x87, 0x1b, 0x38, 0xa4, 0x7e, 0xe2, 0xc1, 0x5d, 0xf2, 0x6e, 0x4d, 0xd1, 0x0b, 0x97, 0xb4, 0x28,
+0x3e, 0xa2, 0x81, 0x1d, 0xc7, 0x5b, 0x78, 0xe4, 0x4b, 0xd7, 0xf4, 0x68, 0xb2, 0x2e, 0x0d, 0x91,
+0xd4, 0x48, 0x6b, 0xf7, 0x2d, 0xb1, 0x92, 0x0e, 0xa1, 0x3d, 0x1e, 0x82, 0x58, 0xc4, 0xe7, 0x7b,
+},
+{
+0x00, 0x88, 0x97, 0x1f, 0xa9, 0x21, 0x3e, 0xb6, 0xd5, 0x5d, 0x42, 0xca, 0x7c, 0xf4, 0xeb, 0x63,
+0x2d, 0xa5, 0xba, 0x32, 0x84, 0x0c, 0x13, 0x9b, 0xf8, 0x70, 0x6f, 0xe7, 0x51, 0xd9, 0xc6, 0x4e,
+0x5a, 0xd2, 0xcd, 0x45, 0xf3, 0x7b, 0x64, 0xec, 0x8f, 0x07, 0x18, 0x90, 0x26, 0xae, 0xb1, 0x39,
+0x77, 0xff, 0xe0, 0x68, 0xde, 0x56, 0x49, 0xc1, 0xa2, 0x2a, 0x35, 0xbd, 0x0b, 0x83, 0x9c, 0x14,
+0xb4, 0x3c, 0x23, 0xab, 0x1d, 0x95, 0x8a, 0x02, 0x61, 0xe9, 0xf6, 0x7e, 0xc8, 0x40, 0x5f, 0xd7,
+0x99, 0x11, 0x0e, 0x86, 0x30, 0xb8, 0xa7, 0x2f, 0x4c, 0xc4, 0xdb, 0x53, 0xe5, 0x6d, 0x72, 0xfa,
+0xee, 0x66, 0x79, 0xf1, 0x47, 0xcf, 0xd0, 0x58, 0x3b, 0xb3, 0xac, 0x24, 0x92, 0x1a, 0x05, 0x8d,
+0xc3, 0x4b, 0x54, 0xdc, 0x6a, 0xe2, 0xfd, 0x75, 0x16, 0x9e, 0x81, 0x09, 0xbf, 0x37, 0x28, 0xa0,
+0xef, 0x67, 0x78, 0xf0, 0x46, 0xce, 0xd1, 0x59, 0x3a, 0xb2, 0xad, 0x25, 0x93, 0x1b, 0x04, 0x8c,
+0xc2, 0x4a, 0x55, 0xdd, 0x6b, 0xe3, 0xfc, 0x74, 0x17, 0x9f, 0x80, 0x08, 0xbe, 0x36, 0x29, 0xa1,
+0xb5, 0x3d, 0x22, 0xaa, 0x1c, 0x94, 0x8b, 0x03, 0x60, 0xe8, 0xf7, 0x7f, 0xc9, 0x41, 0x5e, 0xd6,
+0x98, 0x10, 0x0f, 0x87, 0x31, 0xb9, 0xa6, 0x2e, 0x4d, 0xc5, 0xda, 0x52, 0xe4, 0x6c, 0x73, 0xfb,
+0x5b, 0xd3, 0xcc, 0x44, 0xf2, 0x7a, 0x65, 0xed, 0x8e, 0x06, 0x19, 0x91, 0x27, 0xaf, 0xb0, 0x38,
+0x76, 0xfe, 0xe1, 0x69, 0xdf, 0x57, 0x48, 0xc0, 0xa3, 0x2b, 0x34, 0xbc, 0x0a, 0x82, 0x9d, 0x15,
+0x01, 0x89, 0x96, 0x1e, 0xa8, 0x20, 0x3f, 0xb7, 0xd4, 0x5c, 0x43, 0xcb, 0x7d, 0xf5, 0xea, 0x62,
+0x2c, 0xa4, 0xbb, 0x33, 0x85, 0x0d, 0x12, 0x9a, 0xf9, 0x71, 0x6e, 0xe6, 0x50, 0xd8, 0xc7, 0x4f,
+},
+{
+0x00, 0x41, 0x82, 0xc3, 0x83, 0xc2, 0x01, 0x40, 0x81, 0xc0, 0x03, 0x42, 0x02, 0x43, 0x80, 0xc1,
+0x85, 0xc4, 0x07, 0x46, 0x06, 0x47, 0x84, 0xc5, 0x04, 0x45, 0x86, 0xc7, 0x87, 0xc6, 0x05, 0x44,
+0x8d, 0xcc, 0x0f, 0x4e, 0x0e, 0x4f, 0x8c, 0xcd, 0x0c, 0x4d, 0x8e, 0xcf, 0x8f, 0xce, 0x0d, 0x4c,
+0x08, 0x49, 0x8a, 0xcb, 0x8b, 0xca, 0x09, 0x48, 0x89, 0xc8, 0x0b, 0x4a, 0x0a, 0x4b, 0x88, 0xc9,
+0x9d, 0xdc, 0x1f, 0x5e, 0x1e, 0x5f, 0x9c, 0xdd, 0x1c, 0x5d, 0x9e, 0xdf, 0x9f, 0xde, 0x1d, 0x5c,
+0x18, 0x59, 0x9a, 0xdb, 0x9b, 0xda, 0x19, 0x58, 0x99, 0xd8, 0x1b, 0x5a, 0x1a, 0x5b, 0x98, 0xd9,
+0x10, 0x51, 0x92, 0xd3, 0x93, 0xd2, 0x11, 0x50, 0x91, 0xd0, 0x13, 0x52, 0x12, 0x53, 0x90, 0xd1,
+0x95, 0xd4, 0x17, 0x56, 0x16, 0x57, 0x94, 0xd5, 0x14, 0x55, 0x96, 0xd7, 0x97, 0xd6, 0x15, 0x54,
+0xbd, 0xfc, 0x3f, 0x7e, 0x3e, 0x7f, 0xbc, 0xfd, 0x3c, 0x7d, 0xbe, 0xff, 0xbf, 0xfe, 0x3d, 0x7c,
+0x38, 0x79, 0xba, 0xfb, 0xbb, 0xfa, 0x39, 0x78, 0xb9, 0xf8, 0x3b, 0x7a, 0x3a, 0x7b, 0xb8, 0xf9,
+0x30, 0x71, 0xb2, 0xf3, 0xb3, 0xf2, 0x31, 0x70, 0xb1, 0xf0, 0x33, 0x72, 0x32, 0x73, 0xb0, 0xf1,
+0xb5, 0xf4, 0x37, 0x76, 0x36, 0x77, 0xb4, 0xf5, 0x34, 0x75, 0xb6, 0xf7, 0xb7, 0xf6, 0x35, 0x74,
+0x20, 0x61, 0xa2, 0xe3, 0xa3, 0xe2, 0x21, 0x60, 0xa1, 0xe0, 0x23, 0x62, 0x22, 0x63, 0xa0, 0xe1,
+0xa5, 0xe4, 0x27, 0x66, 0x26, 0x67, 0xa4, 0xe5, 0x24, 0x65, 0xa6, 0xe7, 0xa7, 0xe6, 0x25, 0x64,
+0xad, 0xec, 0x2f, 0x6e, 0x2e, 0x6f, 0xac, 0xed, 0x2c, 0x6d, 0xae, 0xef, 0xaf, 0xee, 0x2d, 0x6c,
+0x28, 0x69, 0xaa, 0xeb, 0xab, 0xea, 0x29, 0x68, 0xa9, 0xe8, 0x2b, 0x6a, 0x2a, 0x6b, 0xa8, 0xe9,
+},
+{
+0x00, 0x73, 0xe6, 0x95, 0x4b, 0x38, 0xad, 0xde, 0x96, 0xe5, 0x70, 0x03, 0xdd, 0xae, 0x3b, 0x48,
+0xab, 0xd8, 0x4d, 0x3e, 0xe0, 0x93, 0x06, 0x75, 0x3d, 0x4e, 0xdb, 0xa8, 0x76, 0x05, 0x90, 0xe3,
+0xd1, 0xa2, 0x37, 0x44, 0x9a, 0xe9, 0x7c, 0x0f, 0x47, 0x34, 0xa1, 0xd2, 0x0c, 0x7f, 0xea, 0x99,
+0x7a, 0x09, 0x9c, 0xef, 0x31, 0x42, 0xd7, 0xa4, 0xec, 0x9f, 0x0a, 0x79, 0xa7, 0xd4, 0x41, 0x32,
+0x25, 0x56, 0xc3, 0xb0, 0x6e, 0x1d, 0x88, 0xfb, 0xb3, 0xc0, 0x55, 0x26, 0xf8, 0x8b, 0x1e, 0x6d,
+0x8e, 0xfd, 0x68, 0x1b, 0xc5, 0xb6, 0x23, 0x50, 0x18, 0x6b, 0xfe, 0x8d, 0x53, 0x20, 0xb5, 0xc6,
+0xf4, 0x87, 0x12, 0x61, 0xbf, 0xcc, 0x59, 0x2a, 0x62, 0x11, 0x84, 0xf7, 0x29, 0x5a, 0xcf, 0xbc,
+0x5f, 0x2c, 0xb9, 0xca, 0x14, 0x67, 0xf2, 0x81, 0xc9, 0xba, 0x2f, 0x5c, 0x82, 0xf1, 0x64, 0x17,
+0x4a, 0x39, 0xac, 0xdf, 0x01, 0x72, 0xe7, 0x94, 0xdc, 0xaf, 0x3a, 0x49, 0x97, 0xe4, 0x71, 0x02,
+0xe1, 0x92, 0x07, 0x74, 0xaa, 0xd9, 0x4c, 0x3f, 0x77, 0x04, 0x91, 0xe2, 0x3c, 0x4f, 0xda, 0xa9,
+0x9b, 0xe8, 0x7d, 0x0e, 0xd0, 0xa3, 0x36, 0x45, 0x0d, 0x7e, 0xeb, 0x98, 0x46, 0x35, 0xa0, 0xd3,
+0x30, 0x43, 0xd6, 0xa5, 0x7b, 0x08, 0x9d, 0xee, 0xa6, 0xd5, 0x40, 0x33, 0xed, 0x9e, 0x0b, 0x78,
+0x6f, 0x1c, 0x89, 0xfa, 0x24, 0x57, 0xc2, 0xb1, 0xf9, 0x8a, 0x1f, 0x6c, 0xb2, 0xc1, 0x54, 0x27,
+0xc4, 0xb7, 0x22, 0x51, 0x8f, 0xfc, 0x69, 0x1a, 0x52, 0x21, 0xb4, 0xc7, 0x19, 0x6a, 0xff, 0x8c,
+0xbe, 0xcd, 0x58, 0x2b, 0xf5, 0x86, 0x13, 0x60, 0x28, 0x5b, 0xce, 0xbd, 0x63, 0x10, 0x85, 0xf6,
+0x15, 0x66, 0xf3, 0x80, 0x5e, 0x2d, 0xb8, 0xcb, 0x83, 0xf0, 0x65, 0x16, 0xc8, 0xbb, 0x2e, 0x5d,
+},
+{
+0x00, 0x35, 0x6a, 0x5f, 0xd4, 0xe1, 0xbe, 0x8b, 0x2f, 0x1a, 0x45, 0x70, 0xfb, 0xce, 0x91, 0xa4,
+0x5e, 0x6b, 0x34, 0x01, 0x8a, 0xbf, 0xe0, 0xd5, 0x71, 0x44, 0x1b, 0x2e, 0xa5, 0x90, 0xcf, 0xfa,
+0xbc, 0x89, 0xd6, 0xe3, 0x68, 0x5d, 0x02, 0x37, 0x93, 0xa6, 0xf9, 0xcc, 0x47, 0x72, 0x2d, 0x18,
+0xe2, 0xd7, 0x88, 0xbd, 0x36, 0x03, 0x5c, 0x69, 0xcd, 0xf8, 0xa7, 0x92, 0x19, 0x2c, 0x73, 0x46,
+0xff, 0xca, 0x95, 0xa0, 0x2b, 0x1e, 0x41, 0x74, 0xd0, 0xe5, 0xba, 0x8f, 0x04, 0x31, 0x6e, 0x5b,
+0xa1, 0x94, 0xcb, 0xfe, 0x75, 0x40, 0x1f, 0x2a, 0x8e, 0xbb, 0xe4, 0xd1, 0x5a, 0x6f, 0x30, 0x05,
+0x43, 0x76, 0x29, 0x1c, 0x97, 0xa2, 0xfd, 0xc8, 0x6c, 0x59, 0x06, 0x33, 0xb8, 0x8d, 0xd2, 0xe7,
+0x1d, 0x28, 0x77, 0x42, 0xc9, 0xfc, 0xa3, 0x96, 0x32, 0x07, 0x58, 0x6d, 0xe6, 0xd3, 0x8c, 0xb9,
+0x79, 0x4c, 0x13, 0x26, 0xad, 0x98, 0xc7, 0xf2, 0x56, 0x63, 0x3c, 0x09, 0x82, 0xb7, 0xe8, 0xdd,
+0x27, 0x12, 0x4d, 0x78, 0xf3, 0xc6, 0x99, 0xac, 0x08, 0x3d, 0x62, 0x57, 0xdc, 0xe9, 0xb6, 0x83,
+0xc5, 0xf0, 0xaf, 0x9a, 0x11, 0x24, 0x7b, 0x4e, 0xea, 0xdf, 0x80, 0xb5, 0x3e, 0x0b, 0x54, 0x61,
+0x9b, 0xae, 0xf1, 0xc4, 0x4f, 0x7a, 0x25, 0x10, 0xb4, 0x81, 0xde, 0xeb, 0x60, 0x55, 0x0a, 0x3f,
+0x86, 0xb3, 0xec, 0xd9, 0x52, 0x67, 0x38, 0x0d, 0xa9, 0x9c, 0xc3, 0xf6, 0x7d, 0x48, 0x17, 0x22,
+0xd8, 0xed, 0xb2, 0x87, 0x0c, 0x39, 0x66, 0x53, 0xf7, 0xc2, 0x9d, 0xa8, 0x23, 0x16, 0x49, 0x7c,
+0x3a, 0x0f, 0x50, 0x65, 0xee, 0xdb, 0x84, 0xb1, 0x15, 0x20, 0x7f, 0x4a, 0xc1, 0xf4, 0xab, 0x9e,
+0x64, 0x51, 0x0e, 0x3b, 0xb0, 0x85, 0xda, 0xef, 0x4b, 0x7e, 0x21, 0x14, 0x9f, 0xaa, 0xf5, 0xc0,
+},
+{
+0x00, 0x0b, 0x16, 0x1d, 0x2c, 0x27, 0x3a, 0x31, 0x58, 0x53, 0x4e, 0x45, 0x74, 0x7f, 0x62, 0x69,
+0xb0, 0xbb, 0xa6, 0xad, 0x9c, 0x97, 0x8a, 0x81, 0xe8, 0xe3, 0xfe, 0xf5, 0xc4, 0xcf, 0xd2, 0xd9,
+0xe7, 0xec, 0xf1, 0xfa, 0xcb, 0xc0, 0xdd, 0xd6, 0xbf, 0xb4, 0xa9, 0xa2, 0x93, 0x98, 0x85, 0x8e,
+0x57, 0x5c, 0x41, 0x4a, 0x7b, 0x70, 0x6d, 0x66, 0x0f, 0x04, 0x19, 0x12, 0x23, 0x28, 0x35, 0x3e,
+0x49, 0x42, 0x5f, 0x54, 0x65, 0x6e, 0x73, 0x78, 0x11, 0x1a, 0x07, 0x0c, 0x3d, 0x36, 0x2b, 0x20,
+0xf9, 0xf2, 0xef, 0xe4, 0xd5, 0xde, 0xc3, 0xc8, 0xa1, 0xaa, 0xb7, 0xbc, 0x8d, 0x86, 0x9b, 0x90,
+0xae, 0xa5, 0xb8, 0xb3, 0x82, 0x89, 0x94, 0x9f, 0xf6, 0xfd, 0xe0, 0xeb, 0xda, 0xd1, 0xcc, 0xc7,
+0x1e, 0x15, 0x08, 0x03, 0x32, 0x39, 0x24, 0x2f, 0x46, 0x4d, 0x50, 0x5b, 0x6a, 0x61, 0x7c, 0x77,
+0x92, 0x99, 0x84, 0x8f, 0xbe, 0xb5, 0xa8, 0xa3, 0xca, 0xc1, 0xdc, 0xd7, 0xe6, 0xed, 0xf0, 0xfb,
+0x22, 0x29, 0x34, 0x3f, 0x0e, 0x05, 0x18, 0x13, 0x7a, 0x71, 0x6c, 0x67, 0x56, 0x5d, 0x40, 0x4b,
+0x75, 0x7e, 0x63, 0x68, 0x59, 0x52, 0x4f, 0x44, 0x2d, 0x26, 0x3b, 0x30, 0x01, 0x0a, 0x17, 0x1c,
+0xc5, 0xce, 0xd3, 0xd8, 0xe9, 0xe2, 0xff, 0xf4, 0x9d, 0x96, 0x8b, 0x80, 0xb1, 0xba, 0xa7, 0xac,
+0xdb, 0xd0, 0xcd, 0xc6, 0xf7, 0xfc, 0xe1, 0xea, 0x83, 0x88, 0x95, 0x9e, 0xaf, 0xa4, 0xb9, 0xb2,
+0x6b, 0x60, 0x7d, 0x76, 0x47, 0x4c, 0x51, 0x5a, 0x33, 0x38, 0x25, 0x2e, 0x1f, 0x14, 0x09, 0x02,
+0x3c, 0x37, 0x2a, 0x21, 0x10, 0x1b, 0x06, 0x0d, 0x64, 0x6f, 0x72, 0x79, 0x48, 0x43, 0x5e, 0x55,
+0x8c, 0x87, 0x9a, 0x91, 0xa0, 0xab, 0xb6, 0xbd, 0xd4, 0xdf, 0xc2, 0xc9, 0xf8, 0xf3, 0xee, 0xe5,
+},
+{
+0x00, 0x0a, 0x14, 0x1e, 0x28, 0x22, 0x3c, 0x36, 0x50, 0x5a, 0x44, 0x4e, 0x78, 0x72, 0x6c, 0x66,
+0xa0, 0xaa, 0xb4, 0xbe, 0x88, 0x82, 0x9c, 0x96, 0xf0, 0xfa, 0xe4, 0xee, 0xd8, 0xd2, 0xcc, 0xc6,
+0xc7, 0xcd, 0xd3, 0xd9, 0xef, 0xe5, 0xfb, 0xf1, 0x97, 0x9d, 0x83, 0x89, 0xbf, 0xb5, 0xab, 0xa1,
+0x67, 0x6d, 0x73, 0x79, 0x4f, 0x45, 0x5b, 0x51, 0x37, 0x3d, 0x23, 0x29, 0x1f, 0x15, 0x0b, 0x01,
+0x09, 0x03, 0x1d, 0x17, 0x21, 0x2b, 0x35, 0x3f, 0x59, 0x53, 0x4d, 0x47, 0x71, 0x7b, 0x65, 0x6f,
+0xa9, 0xa3, 0xbd, 0xb7, 0x81, 0x8b, 0x95, 0x9f, 0xf9, 0xf3, 0xed, 0xe7, 0xd1, 0xdb, 0xc5, 0xcf,
+0xce, 0xc4, 0xda, 0xd0, 0xe6, 0xec, 0xf2, 0xf8, 0x9e, 0x94, 0x8a, 0x80, 0xb6, 0xbc, 0xa2, 0xa8,
+0x6e, 0x64, 0x7a, 0x70, 0x46, 0x4c, 0x52, 0x58, 0x3e, 0x34, 0x2a, 0x20, 0x16, 0x1c, 0x02, 0x08,
+0x12, 0x18, 0x06, 0x0c, 0x3a, 0x30, 0x2e, 0x24, 0x42, 0x48, 0x56, 0x5c, 0x6a, 0x60, 0x7e, 0x74,
+0xb2, 0xb8, 0xa6, 0xac, 0x9a, 0x90, 0x8e, 0x84, 0xe2, 0xe8, 0xf6, 0xfc, 0xca, 0xc0, 0xde, 0xd4,
+0xd5, 0xdf, 0xc1, 0xcb, 0xfd, 0xf7, 0xe9, 0xe3, 0x85, 0x8f, 0x91, 0x9b, 0xad, 0xa7, 0xb9, 0xb3,
+0x75, 0x7f, 0x61, 0x6b, 0x5d, 0x57, 0x49, 0x43, 0x25, 0x2f, 0x31, 0x3b, 0x0d, 0x07, 0x19, 0x13,
+0x1b, 0x11, 0x0f, 0x05, 0x33, 0x39, 0x27, 0x2d, 0x4b, 0x41, 0x5f, 0x55, 0x63, 0x69, 0x77, 0x7d,
+0xbb, 0xb1, 0xaf, 0xa5, 0x93, 0x99, 0x87, 0x8d, 0xeb, 0xe1, 0xff, 0xf5, 0xc3, 0xc9, 0xd7, 0xdd,
+0xdc, 0xd6, 0xc8, 0xc2, 0xf4, 0xfe, 0xe0, 0xea, 0x8c, 0x86, 0x98, 0x92, 0xa4, 0xae, 0xb0, 0xba,
+0x7c, 0x76, 0x68, 0x62, 0x54, 0x5e, 0x40, 0x4a, 0x2c, 0x26, 0x38, 0x32, 0x04, 0x0e, 0x10, 0x1a,
+},
+{
+0x00, 0xa7, 0xc9, 0x6e, 0x15, 0xb2, 0xdc, 0x7b, 0x2a, 0x8d, 0xe3, 0x44, 0x3f, 0x98, 0xf6, 0x51,
+0x54, 0xf3, 0x9d, 0x3a, 0x41, 0xe6, 0x88, 0x2f, 0x7e, 0xd9, 0xb7, 0x10, 0x6b, 0xcc, 0xa2, 0x05,
+0xa8, 0x0f, 0x61, 0xc6, 0xbd, 0x1a, 0x74, 0xd3, 0x82, 0x25, 0x4b, 0xec, 0x97, 0x30, 0x5e, 0xf9,
+0xfc, 0x5b, 0x35, 0x92, 0xe9, 0x4e, 0x20, 0x87, 0xd6, 0x71, 0x1f, 0xb8, 0xc3, 0x64, 0x0a, 0xad,
+0xd7, 0x70, 0x1e, 0xb9, 0xc2, 0x65, 0x0b, 0xac, 0xfd, 0x5a, 0x34, 0x93, 0xe8, 0x4f, 0x21, 0x86,
+0x83, 0x24, 0x4a, 0xed, 0x96, 0x31, 0x5f, 0xf8, 0xa9, 0x0e, 0x60, 0xc7, 0xbc, 0x1b, 0x75, 0xd2,
+0x7f, 0xd8, 0xb6, 0x11, 0x6a, 0xcd, 0xa3, 0x04, 0x55, 0xf2, 0x9c, 0x3b, 0x40, 0xe7, 0x89, 0x2e,
+0x2b, 0x8c, 0xe2, 0x45, 0x3e, 0x99, 0xf7, 0x50, 0x01, 0xa6, 0xc8, 0x6f, 0x14, 0xb3, 0xdd, 0x7a,
+0x29, 0x8e, 0xe0, 0x47, 0x3c, 0x9b, 0xf5, 0x52, 0x03, 0xa4, 0xca, 0x6d, 0x16, 0xb1, 0xdf, 0x78,
+0x7d, 0xda, 0xb4, 0x13, 0x68, 0xcf, 0xa1, 0x06, 0x57, 0xf0, 0x9e, 0x39, 0x42, 0xe5, 0x8b, 0x2c,
+0x81, 0x26, 0x48, 0xef, 0x94, 0x33, 0x5d, 0xfa, 0xab, 0x0c, 0x62, 0xc5, 0xbe, 0x19, 0x77, 0xd0,
+0xd5, 0x72, 0x1c, 0xbb, 0xc0, 0x67, 0x09, 0xae, 0xff, 0x58, 0x36, 0x91, 0xea, 0x4d, 0x23, 0x84,
+0xfe, 0x59, 0x37, 0x90, 0xeb, 0x4c, 0x22, 0x85, 0xd4, 0x73, 0x1d, 0xba, 0xc1, 0x66, 0x08, 0xaf,
+0xaa, 0x0d, 0x63, 0xc4, 0xbf, 0x18, 0x76, 0xd1, 0x80, 0x27, 0x49, 0xee, 0x95, 0x32, 0x5c, 0xfb,
+0x56, 0xf1, 0x9f, 0x38, 0x43, 0xe4, 0x8a, 0x2d, 0x7c, 0xdb, 0xb5, 0x12, 0x69, 0xce, 0xa0, 0x07,
+0x02, 0xa5, 0xcb, 0x6c, 0x17, 0xb0, 0xde, 0x79, 0x28, 0x8f, 0xe1, 0x46, 0x3d, 0x9a, 0xf4, 0x53,
+},
+{
+0x00, 0x19, 0x32, 0x2b, 0x64, 0x7d, 0x56, 0x4f, 0xc8, 0xd1, 0xfa, 0xe3, 0xac, 0xb5, 0x9e, 0x87,
+0x17, 0x0e, 0x25, 0x3c, 0x73, 0x6a, 0x41, 0x58, 0xdf, 0xc6, 0xed, 0xf4, 0xbb, 0xa2, 0x89, 0x90,
+0x2e, 0x37, 0x1c, 0x05, 0x4a, 0x53, 0x78, 0x61, 0xe6, 0xff, 0xd4, 0xcd, 0x82, 0x9b, 0xb0, 0xa9,
+0x39, 0x20, 0x0b, 0x12, 0x5d, 0x44, 0x6f, 0x76, 0xf1, 0xe8, 0xc3, 0xda, 0x95, 0x8c, 0xa7, 0xbe,
+0x5c, 0x45, 0x6e, 0x77, 0x38, 0x21, 0x0a, 0x13, 0x94, 0x8d, 0xa6, 0xbf, 0xf0, 0xe9, 0xc2, 0xdb,
+0x4b, 0x52, 0x79, 0x60, 0x2f, 0x36, 0x1d, 0x04, 0x83, 0x9a, 0xb1, 0xa8, 0xe7, 0xfe, 0xd5, 0xcc,
+0x72, 0x6b, 0x40, 0x59, 0x16, 0x0f, 0x24, 0x3d, 0xba, 0xa3, 0x88, 0x91, 0xde, 0xc7, 0xec, 0xf5,
+0x65, 0x7c, 0x57, 0x4e, 0x01, 0x18, 0x33, 0x2a, 0xad, 0xb4, 0x9f, 0x86, 0xc9, 0xd0, 0xfb, 0xe2,
+0xb8, 0xa1, 0x8a, 0x93, 0xdc, 0xc5, 0xee, 0xf7, 0x70, 0x69, 0x42, 0x5b, 0x14, 0x0d, 0x26, 0x3f,
+0xaf, 0xb6, 0x9d, 0x84, 0xcb, 0xd2, 0xf9, 0xe0, 0x67, 0x7e, 0x55, 0x4c, 0x03, 0x1a, 0x31, 0x28,
+0x96, 0x8f, 0xa4, 0xbd, 0xf2, 0xeb, 0xc0, 0xd9, 0x5e, 0x47, 0x6c, 0x75, 0x3a, 0x23, 0x08, 0x11,
+0x81, 0x98, 0xb3, 0xaa, 0xe5, 0xfc, 0xd7, 0xce, 0x49, 0x50, 0x7b, 0x62, 0x2d, 0x34, 0x1f, 0x06,
+0xe4, 0xfd, 0xd6, 0xcf, 0x80, 0x99, 0xb2, 0xab, 0x2c, 0x35, 0x1e, 0x07, 0x48, 0x51, 0x7a, 0x63,
+0xf3, 0xea, 0xc1, 0xd8, 0x97, 0x8e, 0xa5, 0xbc, 0x3b, 0x22, 0x09, 0x10, 0x5f, 0x46, 0x6d, 0x74,
+0xca, 0xd3, 0xf8, 0xe1, 0xae, 0xb7, 0x9c, 0x85, 0x02, 0x1b, 0x30, 0x29, 0x66, 0x7f, 0x54, 0x4d,
+0xdd, 0xc4, 0xef, 0xf6, 0xb9, 0xa0, 0x8b, 0x92, 0x15, 0x0c, 0x27, 0x3e, 0x71, 0x68, 0x43, 0x5a,
+},
+{
+0x00, 0x23, 0x46, 0x65, 0x8c, 0xaf, 0xca, 0xe9, 0x9f, 0xbc, 0xd9, 0xfa, 0x13, 0x30, 0x55, 0x76,
+0xb9, 0x9a, 0xff, 0xdc, 0x35, 0x16, 0x73, 0x50, 0x26, 0x05, 0x60, 0x43, 0xaa, 0x89, 0xec, 0xcf,
+0xf5, 0xd6, 0xb3, 0x90, 0x79, 0x5a, 0x3f, 0x1c, 0x6a, 0x49, 0x2c, 0x0f, 0xe6, 0xc5, 0xa0, 0x83,
+0x4c, 0x6f, 0x0a, 0x29, 0xc0, 0xe3, 0x86, 0xa5, 0xd3, 0xf0, 0x95, 0xb6, 0x5f, 0x7c, 0x19, 0x3a,
+0x6d, 0x4e, 0x2b, 0x08, 0xe1, 0xc2, 0xa7, 0x84, 0xf2, 0xd1, 0xb4, 0x97, 0x7e, 0x5d, 0x38, 0x1b,
+0xd4, 0xf7, 0x92, 0xb1, 0x58, 0x7b, 0x1e, 0x3d, 0x4b, 0x68, 0x0d, 0x2e, 0xc7, 0xe4, 0x81, 0xa2,
+0x98, 0xbb, 0xde, 0xfd, 0x14, 0x37, 0x52, 0x71, 0x07, 0x24, 0x41, 0x62, 0x8b, 0xa8, 0xcd, 0xee,
+0x21, 0x02, 0x67, 0x44, 0xad, 0x8e, 0xeb, 0xc8, 0xbe, 0x9d, 0xf8, 0xdb, 0x32, 0x11, 0x74, 0x57,
+0xda, 0xf9, 0x9c, 0xbf, 0x56, 0x75, 0x10, 0x33, 0x45, 0x66, 0x03, 0x20, 0xc9, 0xea, 0x8f, 0xac,
+0x63, 0x40, 0x25, 0x06, 0xef, 0xcc, 0xa9, 0x8a, 0xfc, 0xdf, 0xba, 0x99, 0x70, 0x53, 0x36, 0x15,
+0x2f, 0x0c, 0x69, 0x4a, 0xa3, 0x80, 0xe5, 0xc6, 0xb0, 0x93, 0xf6, 0xd5, 0x3c, 0x1f, 0x7a, 0x59,
+0x96, 0xb5, 0xd0, 0xf3, 0x1a, 0x39, 0x5c, 0x7f, 0x09, 0x2a, 0x4f, 0x6c, 0x85, 0xa6, 0xc3, 0xe0,
+0xb7, 0x94, 0xf1, 0xd2, 0x3b, 0x18, 0x7d, 0x5e, 0x28, 0x0b, 0x6e, 0x4d, 0xa4, 0x87, 0xe2, 0xc1,
+0x0e, 0x2d, 0x48, 0x6b, 0x82, 0xa1, 0xc4, 0xe7, 0x91, 0xb2, 0xd7, 0xf4, 0x1d, 0x3e, 0x5b, 0x78,
+0x42, 0x61, 0x04, 0x27, 0xce, 0xed, 0x88, 0xab, 0xdd, 0xfe, 0x9b, 0xb8, 0x51, 0x72, 0x17, 0x34,
+0xfb, 0xd8, 0xbd, 0x9e, 0x77, 0x54, 0x31, 0x12, 0x64, 0x47, 0x22, 0x01, 0xe8, 0xcb, 0xae, 0x8d,
+},
+{
+0x00, 0x1f, 0x3e, 0x21, 0x7c, 0x63, 0x42, 0x5d, 0xf8, 0xe7, 0xc6, 0xd9, 0x84, 0x9b, 0xba, 0xa5,
+0x77, 0x68, 0x49, 0x56, 0x0b, 0x14, 0x35, 0x2a, 0x8f, 0x90, 0xb1, 0xae, 0xf3, 0xec, 0xcd, 0xd2,
+0xee, 0xf1, 0xd0, 0xcf, 0x92, 0x8d, 0xac, 0xb3, 0x16, 0x09, 0x28, 0x37, 0x6a, 0x75, 0x54, 0x4b,
+0x99, 0x86, 0xa7, 0xb8, 0xe5, 0xfa, 0xdb, 0xc4, 0x61, 0x7e, 0x5f, 0x40, 0x1d, 0x02, 0x23, 0x3c,
+0x5b, 0x44, 0x65, 0x7a, 0x27, 0x38, 0x19, 0x06, 0xa3, 0xbc, 0x9d, 0x82, 0xdf, 0xc0, 0xe1, 0xfe,
+0x2c, 0x33, 0x12, 0x0d, 0x50, 0x4f, 0x6e, 0x71, 0xd4, 0xcb, 0xea, 0xf5, 0xa8, 0xb7, 0x96, 0x89,
+0xb5, 0xaa, 0x8b, 0x94, 0xc9, 0xd6, 0xf7, 0xe8, 0x4d, 0x52, 0x73, 0x6c, 0x31, 0x2e, 0x0f, 0x10,
+0xc2, 0xdd, 0xfc, 0xe3, 0xbe, 0xa1, 0x80, 0x9f, 0x3a, 0x25, 0x04, 0x1b, 0x46, 0x59, 0x78, 0x67,
+0xb6, 0xa9, 0x88, 0x97, 0xca, 0xd5, 0xf4, 0xeb, 0x4e, 0x51, 0x70, 0x6f, 0x32, 0x2d, 0x0c, 0x13,
+0xc1, 0xde, 0xff, 0xe0, 0xbd, 0xa2, 0x83, 0x9c, 0x39, 0x26, 0x07, 0x18, 0x45, 0x5a, 0x7b, 0x64,
+0x58, 0x47, 0x66, 0x79, 0x24, 0x3b, 0x1a, 0x05, 0xa0, 0xbf, 0x9e, 0x81, 0xdc, 0xc3, 0xe2, 0xfd,
+0x2f, 0x30, 0x11, 0x0e, 0x53, 0x4c, 0x6d, 0x72, 0xd7, 0xc8, 0xe9, 0xf6, 0xab, 0xb4, 0x95, 0x8a,
+0xed, 0xf2, 0xd3, 0xcc, 0x91, 0x8e, 0xaf, 0xb0, 0x15, 0x0a, 0x2b, 0x34, 0x69, 0x76, 0x57, 0x48,
+0x9a, 0x85, 0xa4, 0xbb, 0xe6, 0xf9, 0xd8, 0xc7, 0x62, 0x7d, 0x5c, 0x43, 0x1e, 0x01, 0x20, 0x3f,
+0x03, 0x1c, 0x3d, 0x22, 0x7f, 0x60, 0x41, 0x5e, 0xfb, 0xe4, 0xc5, 0xda, 0x87, 0x98, 0xb9, 0xa6,
+0x74, 0x6b, 0x4a, 0x55, 0x08, 0x17, 0x36, 0x29, 0x8c, 0x93, 0xb2, 0xad, 0xf0, 0xef, 0xce, 0xd1,
+},
+{
+0x00, 0xc3, 0x01, 0xc2, 0x02, 0xc1, 0x03, 0xc0, 0x04, 0xc7, 0x05, 0xc6, 0x06, 0xc5, 0x07, 0xc4,
+0x08, 0xcb, 0x09, 0xca, 0x0a, 0xc9, 0x0b, 0xc8, 0x0c, 0xcf, 0x0d, 0xce, 0x0e, 0xcd, 0x0f, 0xcc,
+0x10, 0xd3, 0x11, 0xd2, 0x12, 0xd1, 0x13, 0xd0, 0x14, 0xd7, 0x15, 0xd6, 0x16, 0xd5, 0x17, 0xd4,
+0x18, 0xdb, 0x19, 0xda, 0x1a, 0xd9, 0x1b, 0xd8, 0x1c, 0xdf, 0x1d, 0xde, 0x1e, 0xdd, 0x1f, 0xdc,
+0x20, 0xe3, 0x21, 0xe2, 0x22, 0xe1, 0x23, 0xe0, 0x24, 0xe7, 0x25, 0xe6, 0x26, 0xe5, 0x27, 0xe4,
+0x28, 0xeb, 0x29, 0xea, 0x2a, 0xe9, 0x2b, 0xe8, 0x2c, 0xef, 0x2d, 0xee, 0x2e, 0xed, 0x2f, 0xec,
+0x30, 0xf3, 0x31, 0xf2, 0x32, 0xf1, 0x33, 0xf0, 0x34, 0xf7, 0x35, 0xf6, 0x36, 0xf5, 0x37, 0xf4,
+0x38, 0xfb, 0x39, 0xfa, 0x3a, 0xf9, 0x3b, 0xf8, 0x3c, 0xff, 0x3d, 0xfe, 0x3e, 0xfd, 0x3f, 0xfc,
+0x40, 0x83, 0x41, 0x82, 0x42, 0x81, 0x43, 0x80, 0x44, 0x87, 0x45, 0x86, 0x46, 0x85, 0x47, 0x84,
+0x48, 0x8b, 0x49, 0x8a, 0x4a, 0x89, 0x4b, 0x88, 0x4c, 0x8f, 0x4d, 0x8e, 0x4e, 0x8d, 0x4f, 0x8c,
+0x50, 0x93, 0x51, 0x92, 0x52, 0x91, 0x53, 0x90, 0x54, 0x97, 0x55, 0x96, 0x56, 0x95, 0x57, 0x94,
+0x58, 0x9b, 0x59, 0x9a, 0x5a, 0x99, 0x5b, 0x98, 0x5c, 0x9f, 0x5d, 0x9e, 0x5e, 0x9d, 0x5f, 0x9c,
+0x60, 0xa3, 0x61, 0xa2, 0x62, 0xa1, 0x63, 0xa0, 0x64, 0xa7, 0x65, 0xa6, 0x66, 0xa5, 0x67, 0xa4,
+0x68, 0xab, 0x69, 0xaa, 0x6a, 0xa9, 0x6b, 0xa8, 0x6c, 0xaf, 0x6d, 0xae, 0x6e, 0xad, 0x6f, 0xac,
+0x70, 0xb3, 0x71, 0xb2, 0x72, 0xb1, 0x73, 0xb0, 0x74, 0xb7, 0x75, 0xb6, 0x76, 0xb5, 0x77, 0xb4,
+0x78, 0xbb, 0x79, 0xba, 0x7a, 0xb9, 0x7b, 0xb8, 0x7c, 0xbf, 0x7d, 0xbe, 0x7e, 0xbd, 0x7f, 0xbc,
+},
+{
+0x00, 0x95, 0xad, 0x38, 0xdd, 0x48, 0x70, 0xe5, 0x3d, 0xa8, 0x90, 0x05, 0xe0, 0x75, 0x4d, 0xd8,
+0x7a, 0xef, 0xd7, 0x42, 0xa7, 0x32, 0x0a, 0x9f, 0x47, 0xd2, 0xea, 0x7f, 0x9a, 0x0f, 0x37, 0xa2,
+0xf4, 0x61, 0x59, 0xcc, 0x29, 0xbc, 0x84, 0x11, 0xc9, 0x5c, 0x64, 0xf1, 0x14, 0x81, 0xb9, 0x2c,
+0x8e, 0x1b, 0x23, 0xb6, 0x53, 0xc6, 0xfe, 0x6b, 0xb3, 0x26, 0x1e, 0x8b, 0x6e, 0xfb, 0xc3, 0x56,
+0x6f, 0xfa, 0xc2, 0x57, 0xb2, 0x27, 0x1f, 0x8a, 0x52, 0xc7, 0xff, 0x6a, 0x8f, 0x1a, 0x22, 0xb7,
+0x15, 0x80, 0xb8, 0x2d, 0xc8, 0x5d, 0x65, 0xf0, 0x28, 0xbd, 0x85, 0x10, 0xf5, 0x60, 0x58, 0xcd,
+0x9b, 0x0e, 0x36, 0xa3, 0x46, 0xd3, 0xeb, 0x7e, 0xa6, 0x33, 0x0b, 0x9e, 0x7b, 0xee, 0xd6, 0x43,
+0xe1, 0x74, 0x4c, 0xd9, 0x3c, 0xa9, 0x91, 0x04, 0xdc, 0x49, 0x71, 0xe4, 0x01, 0x94, 0xac, 0x39,
+0xde, 0x4b, 0x73, 0xe6, 0x03, 0x96, 0xae, 0x3b, 0xe3, 0x76, 0x4e, 0xdb, 0x3e, 0xab, 0x93, 0x06,
+0xa4, 0x31, 0x09, 0x9c, 0x79, 0xec, 0xd4, 0x41, 0x99, 0x0c, 0x34, 0xa1, 0x44, 0xd1, 0xe9, 0x7c,
+0x2a, 0xbf, 0x87, 0x12, 0xf7, 0x62, 0x5a, 0xcf, 0x17, 0x82, 0xba, 0x2f, 0xca, 0x5f, 0x67, 0xf2,
+0x50, 0xc5, 0xfd, 0x68, 0x8d, 0x18, 0x20, 0xb5, 0x6d, 0xf8, 0xc0, 0x55, 0xb0, 0x25, 0x1d, 0x88,
+0xb1, 0x24, 0x1c, 0x89, 0x6c, 0xf9, 0xc1, 0x54, 0x8c, 0x19, 0x21, 0xb4, 0x51, 0xc4, 0xfc, 0x69,
+0xcb, 0x5e, 0x66, 0xf3, 0x16, 0x83, 0xbb, 0x2e, 0xf6, 0x63, 0x5b, 0xce, 0x2b, 0xbe, 0x86, 0x13,
+0x45, 0xd0, 0xe8, 0x7d, 0x98, 0x0d, 0x35, 0xa0, 0x78, 0xed, 0xd5, 0x40, 0xa5, 0x30, 0x08, 0x9d,
+0x3f, 0xaa, 0x92, 0x07, 0xe2, 0x77, 0x4f, 0xda, 0x02, 0x97, 0xaf, 0x3a, 0xdf, 0x4a, 0x72, 0xe7,
+},
+{
+0x00, 0x5f, 0xbe, 0xe1, 0xfb, 0xa4, 0x45, 0x1a, 0x71, 0x2e, 0xcf, 0x90, 0x8a, 0xd5, 0x34, 0x6b,
+0xe2, 0xbd, 0x5c, 0x03, 0x19, 0x46, 0xa7, 0xf8, 0x93, 0xcc, 0x2d, 0x72, 0x68, 0x37, 0xd6, 0x89,
+0x43, 0x1c, 0xfd, 0xa2, 0xb8, 0xe7, 0x06, 0x59, 0x32, 0x6d, 0x8c, 0xd3, 0xc9, 0x96, 0x77, 0x28,
+0xa1, 0xfe, 0x1f, 0x40, 0x5a, 0x05, 0xe4, 0xbb, 0xd0, 0x8f, 0x6e, 0x31, 0x2b, 0x74, 0x95, 0xca,
+0x86, 0xd9, 0x38, 0x67, 0x7d, 0x22, 0xc3, 0x9c, 0xf7, 0xa8, 0x49, 0x16, 0x0c, 0x53, 0xb2, 0xed,
+0x64, 0x3b, 0xda, 0x85, 0x9f, 0xc0, 0x21, 0x7e, 0x15, 0x4a, 0xab, 0xf4, 0xee, 0xb1, 0x50, 0x0f,
+0xc5, 0x9a, 0x7b, 0x24, 0x3e, 0x61, 0x80, 0xdf, 0xb4, 0xeb, 0x0a, 0x55, 0x4f, 0x10, 0xf1, 0xae,
+0x27, 0x78, 0x99, 0xc6, 0xdc, 0x83, 0x62, 0x3d, 0x56, 0x09, 0xe8, 0xb7, 0xad, 0xf2, 0x13, 0x4c,
+0x8b, 0xd4, 0x35, 0x6a, 0x70, 0x2f, 0xce, 0x91, 0xfa, 0xa5, 0x44, 0x1b, 0x01, 0x5e, 0xbf, 0xe0,
+0x69, 0x36, 0xd7, 0x88, 0x92, 0xcd, 0x2c, 0x73, 0x18, 0x47, 0xa6, 0xf9, 0xe3, 0xbc, 0x5d, 0x02,
+0xc8, 0x97, 0x76, 0x29, 0x33, 0x6c, 0x8d, 0xd2, 0xb9, 0xe6, 0x07, 0x58, 0x42, 0x1d, 0xfc, 0xa3,
+0x2a, 0x75, 0x94, 0xcb, 0xd1, 0x8e, 0x6f, 0x30, 0x5b, 0x04, 0xe5, 0xba, 0xa0, 0xff, 0x1e, 0x41,
+0x0d, 0x52, 0xb3, 0xec, 0xf6, 0xa9, 0x48, 0x17, 0x7c, 0x23, 0xc2, 0x9d, 0x87, 0xd8, 0x39, 0x66,
+0xef, 0xb0, 0x51, 0x0e, 0x14, 0x4b, 0xaa, 0xf5, 0x9e, 0xc1, 0x20, 0x7f, 0x65, 0x3a, 0xdb, 0x84,
+0x4e, 0x11, 0xf0, 0xaf, 0xb5, 0xea, 0x0b, 0x54, 0x3f, 0x60, 0x81, 0xde, 0xc4, 0x9b, 0x7a, 0x25,
+0xac, 0xf3, 0x12, 0x4d, 0x57, 0x08, 0xe9, 0xb6, 0xdd, 0x82, 0x63, 0x3c, 0x26, 0x79, 0x98, 0xc7,
+},
+{
+0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53, 0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb,
+0x57, 0x4a, 0x6d, 0x70, 0x23, 0x3e, 0x19, 0x04, 0xbf, 0xa2, 0x85, 0x98, 0xcb, 0xd6, 0xf1, 0xec,
+0xae, 0xb3, 0x94, 0x89, 0xda, 0xc7, 0xe0, 0xfd, 0x46, 0x5b, 0x7c, 0x61, 0x32, 0x2f, 0x08, 0x15,
+0xf9, 0xe4, 0xc3, 0xde, 0x8d, 0x90, 0xb7, 0xaa, 0x11, 0x0c, 0x2b, 0x36, 0x65, 0x78, 0x5f, 0x42,
+0xdb, 0xc6, 0xe1, 0xfc, 0xaf, 0xb2, 0x95, 0x88, 0x33, 0x2e, 0x09, 0x14, 0x47, 0x5a, 0x7d, 0x60,
+0x8c, 0x91, 0xb6, 0xab, 0xf8, 0xe5, 0xc2, 0xdf, 0x64, 0x79, 0x5e, 0x43, 0x10, 0x0d, 0x2a, 0x37,
+0x75, 0x68, 0x4f, 0x52, 0x01, 0x1c, 0x3b, 0x26, 0x9d, 0x80, 0xa7, 0xba, 0xe9, 0xf4, 0xd3, 0xce,
+0x22, 0x3f, 0x18, 0x05, 0x56, 0x4b, 0x6c, 0x71, 0xca, 0xd7, 0xf0, 0xed, 0xbe, 0xa3, 0x84, 0x99,
+0x31, 0x2c, 0x0b, 0x16, 0x45, 0x58, 0x7f, 0x62, 0xd9, 0xc4, 0xe3, 0xfe, 0xad, 0xb0, 0x97, 0x8a,
+0x66, 0x7b, 0x5c, 0x41, 0x12, 0x0f, 0x28, 0x35, 0x8e, 0x93, 0xb4, 0xa9, 0xfa, 0xe7, 0xc0, 0xdd,
+0x9f, 0x82, 0xa5, 0xb8, 0xeb, 0xf6, 0xd1, 0xcc, 0x77, 0x6a, 0x4d, 0x50, 0x03, 0x1e, 0x39, 0x24,
+0xc8, 0xd5, 0xf2, 0xef, 0xbc, 0xa1, 0x86, 0x9b, 0x20, 0x3d, 0x1a, 0x07, 0x54, 0x49, 0x6e, 0x73,
+0xea, 0xf7, 0xd0, 0xcd, 0x9e, 0x83, 0xa4, 0xb9, 0x02, 0x1f, 0x38, 0x25, 0x76, 0x6b, 0x4c, 0x51,
+0xbd, 0xa0, 0x87, 0x9a, 0xc9, 0xd4, 0xf3, 0xee, 0x55, 0x48, 0x6f, 0x72, 0x21, 0x3c, 0x1b, 0x06,
+0x44, 0x59, 0x7e, 0x63, 0x30, 0x2d, 0x0a, 0x17, 0xac, 0xb1, 0x96, 0x8b, 0xd8, 0xc5, 0xe2, 0xff,
+0x13, 0x0e, 0x29, 0x34, 0x67, 0x7a, 0x5d, 0x40, 0xfb, 0xe6, 0xc1, 0xdc, 0x8f, 0x92, 0xb5, 0xa8,
+},
+{
+0x00, 0x1e, 0x3c, 0x22, 0x78, 0x66, 0x44, 0x5a, 0xf0, 0xee, 0xcc, 0xd2, 0x88, 0x96, 0xb4, 0xaa,
+0x67, 0x79, 0x5b, 0x45, 0x1f, 0x01, 0x23, 0x3d, 0x97, 0x89, 0xab, 0xb5, 0xef, 0xf1, 0xd3, 0xcd,
+0xce, 0xd0, 0xf2, 0xec, 0xb6, 0xa8, 0x8a, 0x94, 0x3e, 0x20, 0x02, 0x1c, 0x46, 0x58, 0x7a, 0x64,
+0xa9, 0xb7, 0x95, 0x8b, 0xd1, 0xcf, 0xed, 0xf3, 0x59, 0x47, 0x65, 0x7b, 0x21, 0x3f, 0x1d, 0x03,
+0x1b, 0x05, 0x27, 0x39, 0x63, 0x7d, 0x5f, 0x41, 0xeb, 0xf5, 0xd7, 0xc9, 0x93, 0x8d, 0xaf, 0xb1,
+0x7c, 0x62, 0x40, 0x5e, 0x04, 0x1a, 0x38, 0x26, 0x8c, 0x92, 0xb0, 0xae, 0xf4, 0xea, 0xc8, 0xd6,
+0xd5, 0xcb, 0xe9, 0xf7, 0xad, 0xb3, 0x91, 0x8f, 0x25, 0x3b, 0x19, 0x07, 0x5d, 0x43, 0x61, 0x7f,
+0xb2, 0xac, 0x8e, 0x90, 0xca, 0xd4, 0xf6, 0xe8, 0x42, 0x5c, 0x7e, 0x60, 0x3a, 0x24, 0x06, 0x18,
+0x36, 0x28, 0x0a, 0x14, 0x4e, 0x50, 0x72, 0x6c, 0xc6, 0xd8, 0xfa, 0xe4, 0xbe, 0xa0, 0x82, 0x9c,
+0x51, 0x4f, 0x6d, 0x73, 0x29, 0x37, 0x15, 0x0b, 0xa1, 0xbf, 0x9d, 0x83, 0xd9, 0xc7, 0xe5, 0xfb,
+0xf8, 0xe6, 0xc4, 0xda, 0x80, 0x9e, 0xbc, 0xa2, 0x08, 0x16, 0x34, 0x2a, 0x70, 0x6e, 0x4c, 0x52,
+0x9f, 0x81, 0xa3, 0xbd, 0xe7, 0xf9, 0xdb, 0xc5, 0x6f, 0x71, 0x53, 0x4d, 0x17, 0x09, 0x2b, 0x35,
+0x2d, 0x33, 0x11, 0x0f, 0x55, 0x4b, 0x69, 0x77, 0xdd, 0xc3, 0xe1, 0xff, 0xa5, 0xbb, 0x99, 0x87,
+0x4a, 0x54, 0x76, 0x68, 0x32, 0x2c, 0x0e, 0x10, 0xba, 0xa4, 0x86, 0x98, 0xc2, 0xdc, 0xfe, 0xe0,
+0xe3, 0xfd, 0xdf, 0xc1, 0x9b, 0x85, 0xa7, 0xb9, 0x13, 0x0d, 0x2f, 0x31, 0x6b, 0x75, 0x57, 0x49,
+0x84, 0x9a, 0xb8, 0xa6, 0xfc, 0xe2, 0xc0, 0xde, 0x74, 0x6a, 0x48, 0x56, 0x0c, 0x12, 0x30, 0x2e,
+},
+};
+
+#define RS_NAME ccsds
+#define RS_TAB CCSDS
+#include "rs_template.h"
+
+#endif /* RS_CCSDS_H */
@@ -0,0 +1,156 @@
+/* rs_gen.c
+ * Generate the tables for a Reed-Solomon code over GF(2^m), m <= 8, as a
+ * C header that instantiates rs_template.h for it, so the field, generator
+ * and syndrome tables the template uses are constants and the compiler
+ * sees every parameter of the code as one.  The encoder tables in rs.c
+ * (rs_table[], its nibble halves and the dual basis ones) are still built
+ * at run time by rs_init().
+ *
+ * gcc -o rs_gen rs_gen.c
+ * ./rs_gen name gfpoly fcr prim nroots > rs_name.h
+ *
+ * rs_ccsds.h, the CCSDS (255,223) code, was made with
+ * ./rs_gen ccsds 0x187 112 11 32 > rs_ccsds.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#define MAX_NN 255
+
+static int mm, nn;
+
+static int modnn(int x)
+{
+	while (x >= nn) {
+		x -= nn;
+		x = (x >> mm) + (x & nn);
+	}
+	return x;
+}
+
+// Print v[0..n-1] 16 to a line, each with fmt and a comma
+static void print_table(const char *name, const char *size, const int *v, int n, const char *fmt)
+{
+	printf("static const unsigned char %s[%s] = {\n", name, size);
+	for (int i = 0; i < n; i++) {
+		printf(fmt, v[i]);
+		putchar(i % 16 == 15 || i == n - 1 ? '\n' : ' ');
+	}
+	printf("};\n\n");
+}
+
+int main(int argc, char * argv[])
+{
+	int alpha_to[MAX_NN + 1], index_of[MAX_NN + 1], genpoly[MAX_NN + 1];
+	int gfpoly, fcr, prim, nroots, sr, root;
+	char NAME[64];
+
+	if (argc != 6) {
+		fprintf(stderr, "usage: %s name gfpoly fcr prim nroots > rs_name.h\n", argv[0]);
+		return 1;
+	}
+	gfpoly = strtol(argv[2], NULL, 0);
+	fcr = strtol(argv[3], NULL, 0);
+	prim = strtol(argv[4], NULL, 0);
+	nroots = strtol(argv[5], NULL, 0);
+	for (mm = 0; (gfpoly >> (mm + 1)) != 0; mm++)
+		;
+	nn = (1 << mm) - 1;
+	if (mm < 2 || mm > 8 || fcr < 0 || fcr >= nn + 1 || prim <= 0 || prim > nn
+		|| nroots <= 0 || nroots >= nn) {
+		fprintf(stderr, "%s: need 2 <= m <= 8, 0 <= fcr <= 2^m - 1, 1 <= prim <= 2^m - 1, "
+			"0 < nroots < 2^m - 1\n", argv[0]);
+		return 1;
+	}
+	for (int i = 0; argv[1][i] && i < 63; i++)
+		NAME[i] = toupper((unsigned char)argv[1][i]), NAME[i + 1] = 0;
+
+	// the field: powers of alpha, and their logs.  alpha must not come
+	// back to 1 (or reach 0) before all nn powers are out, or the
+	// polynomial is not primitive and some logs would be missing
+	for (int i = 0; i <= nn; i++)
+		index_of[i] = nn;	// log(0) = A0
+	alpha_to[nn] = 0;
+	sr = 1;
+	for (int i = 0; i < nn; i++) {
+		index_of[sr] = i;
+		alpha_to[i] = sr;
+		sr <<= 1;
+		if (sr & (1 << mm))
+			sr ^= gfpoly;
+		sr &= nn;
+		if (sr == 0 || (sr == 1) != (i == nn - 1)) {
+			fprintf(stderr, "%s: 0x%x is not a primitive polynomial\n", argv[0], gfpoly);
+			return 1;
+		}
+	}
+
+	// the generator polynomial, from its roots alpha^((fcr + i) * prim)
+	genpoly[0] = 1;
+	for (int i = 0, root = fcr * prim; i < nroots; i++, root += prim) {
+		genpoly[i + 1] = 1;
+		for (int j = i; j > 0; j--)
+			genpoly[j] = genpoly[j] ? genpoly[j - 1] ^ alpha_to[modnn(index_of[genpoly[j]] + root)]
+				: genpoly[j - 1];
+		genpoly[0] = alpha_to[modnn(index_of[genpoly[0]] + root)];
+	}
+	for (int i = 0; i <= nroots; i++)
+		genpoly[i] = index_of[genpoly[i]];
+
+	printf("/* rs_%s.h\n * Generated by rs_gen %s %s %s %s %s -- do not edit.\n */\n\n",
+		argv[1], argv[1], argv[2], argv[3], argv[4], argv[5]);
+	printf("#ifndef RS_%s_H\n#define RS_%s_H\n\n", NAME, NAME);
+	printf("#define %s_MM %d\t\t// bits per symbol\n", NAME, mm);
+	printf("#define %s_NN %d\t// symbols per codeword\n", NAME, nn);
+	printf("#define %s_NROOTS %d\t// parity symbols\n", NAME, nroots);
+	printf("#define %s_FCR %d\t// first consecutive root, index form\n", NAME, fcr);
+	printf("#define %s_PRIM %d\t// spacing of the roots\n", NAME, prim);
+	printf("#define %s_GFPOLY 0x%x\t// field generator polynomial\n\n", NAME, gfpoly);
+
+	printf("// GF antilog table; %s_alpha_to[%s_NN] = 0\n", NAME, NAME);
+	{
+		char name[80], size[80];
+		sprintf(name, "%s_alpha_to", NAME);
+		sprintf(size, "%s_NN+1", NAME);
+		print_table(name, size, alpha_to, nn + 1, "0x%02x,");
+		printf("// GF log table; log(0) is %s_NN\n", NAME);
+		sprintf(name, "%s_index_of", NAME);
+		print_table(name, size, index_of, nn + 1, "%3d,");
+		printf("// Generator polynomial in index form, coefficient of x^i at [i]\n");
+		sprintf(name, "%s_poly", NAME);
+		sprintf(size, "%s_NROOTS+1", NAME);
+		print_table(name, size, genpoly, nroots + 1, "%3d,");
+	}
+
+	// the generator as bit matrices: x * G[i] is the XOR of the
+	// genmul[i][j] for which bit j of x is set
+	printf("// %s_genmul[i][j] = generator coefficient i times alpha^j, for bit-sliced encoders\n", NAME);
+	printf("static const unsigned char %s_genmul[%s_NROOTS+1][%s_MM] = {\n", NAME, NAME, NAME);
+	for (int i = 0; i <= nroots; i++) {
+		printf("{");
+		for (int j = 0; j < mm; j++)
+			printf("0x%02x%s", genpoly[i] == nn ? 0 : alpha_to[modnn(genpoly[i] + j)],
+				j < mm - 1 ? ", " : "},\n");
+	}
+	printf("};\n\n");
+
+	// one Horner step of the syndrome at each root: x times that root
+	printf("// %s_synmul[i][x] = x * alpha^((FCR + i) * PRIM)\n", NAME);
+	printf("static const unsigned char %s_synmul[%s_NROOTS][%s_NN+1] = {\n", NAME, NAME, NAME);
+	root = fcr * prim;
+	for (int i = 0; i < nroots; i++, root += prim) {
+		printf("{\n");
+		for (int x = 0; x <= nn; x++) {
+			printf("0x%02x,", x == 0 ? 0 : alpha_to[modnn(index_of[x] + modnn(root))]);
+			putchar(x % 16 == 15 || x == nn ? '\n' : ' ');
+		}
+		printf("},\n");
+	}
+	printf("};\n\n");
+
+	printf("#define RS_NAME %s\n#define RS_TAB %s\n#include \"rs_template.h\"\n\n", argv[1], NAME);
+	printf("#endif /* RS_%s_H */\n", NAME);
+	return 0;
+}
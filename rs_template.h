@@ -0,0 +1,311 @@
+/* rs_template.h
+ * A Reed-Solomon code over GF(2^m), m <= 8, written once for any code.
+ *
+ * Do not include this directly.  rs_gen writes a header for each code
+ * with its tables and parameters as constants; that header defines
+ * RS_NAME, the prefix for the functions, and RS_TAB, the prefix of its
+ * tables, and includes this file, so the functions below are compiled
+ * separately for each code with everything known to the compiler:
+ *
+ *   NAME_update(parity, c)     byte at a time encoder, like update_rs()
+ *   NAME_syndromes(data, len, s)
+ *   NAME_chien_init(data_len, chien_start)
+ *   NAME_decode(data, data_len, root_start, chien_start, eras_pos, no_eras)
+ *   NAME_decode_syn(..., s, basis)  the same from syndromes already formed
+ *   NAME_decode_len(data, data_len, eras_pos, no_eras)
+ *
+ * Define RS_SYNDROMES before including the code's header to have the
+ * decoder use a faster syndrome function than NAME_syndromes().
+ */
+
+#include <string.h>
+
+// paste the prefix on without expanding x, which may be NN, PRIM etc.
+// defined by the includer
+#define RS_CAT2(a,b) a##b
+#define RS_CAT(a,b) RS_CAT2(a,b)
+#define RS_FN(f) RS_CAT(RS_NAME,_##f)
+#define RS_T(x) RS_CAT(RS_TAB,_##x)
+
+#define RS_MM RS_T(MM)
+#define RS_NN RS_T(NN)
+#define RS_A0 RS_NN			// log(0)
+#define RS_NROOTS RS_T(NROOTS)
+#define RS_FCR RS_T(FCR)
+#define RS_PRIM RS_T(PRIM)
+#define RS_ALPHA_TO RS_T(alpha_to)
+#define RS_INDEX_OF RS_T(index_of)
+#define RS_GENPOLY RS_T(poly)
+#define RS_SYNMUL RS_T(synmul)
+#ifndef RS_SYNDROMES
+#define RS_SYNDROMES RS_FN(syndromes)
+#endif
+
+static inline int RS_FN(modnn)(int x){
+  while (x >= RS_NN) {
+    x -= RS_NN;
+    x = (x >> RS_MM) + (x & RS_NN);
+  }
+  return x;
+}
+
+/* Add data byte c to the NROOTS byte encoder register parity[], clear
+   before each codeword; afterwards parity[0] is the first to send */
+static inline void RS_FN(update)(unsigned char *parity, unsigned char c)
+{
+  int j,feedback;
+
+  feedback = RS_INDEX_OF[c ^ parity[0]];
+  if(feedback != RS_A0){
+    for(j=1;j<RS_NROOTS;j++)
+      parity[j] ^= RS_ALPHA_TO[RS_FN(modnn)(feedback + RS_GENPOLY[RS_NROOTS-j])];
+  }
+  memmove(&parity[0],&parity[1],RS_NROOTS-1);
+  parity[RS_NROOTS-1] = feedback == RS_A0 ? 0 : RS_ALPHA_TO[RS_FN(modnn)(feedback + RS_GENPOLY[0])];
+}
+
+/* The NROOTS syndromes of a len symbol (shortened) codeword, in
+   polynomial form; returns 0 only if they are all zero */
+static inline int RS_FN(syndromes)(const unsigned char *data, int len, unsigned char *s)
+{
+  int i,j,any = 0;
+
+  for(i=0;i<RS_NROOTS;i++)
+    s[i] = data[0];
+  for(j=1;j<len;j++){
+    for(i=0;i<RS_NROOTS;i++)
+      s[i] = RS_SYNMUL[i][s[i]] ^ data[j];
+  }
+  for(i=0;i<RS_NROOTS;i++)
+    any |= s[i];
+  return any;
+}
+
+/* Chien search start for a code shortened to data_len data symbols:
+   fills chien_start[0..NROOTS] and returns the root for the first symbol
+   sent, or -1 if data_len is out of range.  See rs_code_init() in rs.c. */
+static inline int RS_FN(chien_init)(int data_len, unsigned char *chien_start)
+{
+  int j,pad,root_start;
+
+  if(data_len < 1 || data_len > RS_NN-RS_NROOTS)
+    return -1;
+  pad = RS_NN - (data_len + RS_NROOTS);
+  root_start = RS_FN(modnn)(RS_NN - RS_FN(modnn)(RS_PRIM*(RS_NN-1-pad)));
+  for(j=0;j<=RS_NROOTS;j++)
+    chien_start[j] = RS_FN(modnn)(j*root_start);
+  return root_start;
+}
+
+/* Errors and erasures decoder, after Phil Karn's decode_rs() in libfec,
+   from the syndromes s[] of data[], which must not all be zero.
+   Everything is on the stack.  Positions are counted in the full
+   codeword, where the data starts at pad, after the virtual zeros.
+   If the symbols of data[] are in another basis, basis[] maps an error
+   value in polynomial form to it (the map must be linear); NULL if not. */
+static inline int RS_FN(decode_syn)(
+   unsigned char *data, // data_len data symbols then NROOTS parities, fixed in place
+   int data_len,
+   int root_start,      // from NAME_chien_init(data_len, chien_start)
+   const unsigned char *chien_start,
+   const int *eras_pos, // erased positions in data[], or NULL
+   int no_eras,
+   unsigned char *s,    // NROOTS syndromes, in polynomial form; overwritten
+   const unsigned char *basis)
+{
+  int deg_lambda,el,deg_omega;
+  int i,j,r,k;
+  unsigned char u,q,tmp,num1,num2,den,discr_r;
+  unsigned char lambda[RS_NROOTS+1]; // Err+Eras Locator poly
+  unsigned char b[RS_NROOTS+1],t[RS_NROOTS+1],omega[RS_NROOTS+1];
+  unsigned char root[RS_NROOTS],reg[RS_NROOTS+1],loc[RS_NROOTS],val[RS_NROOTS];
+  int count;
+  int len = data_len + RS_NROOTS, pad = RS_NN - len;
+  unsigned char step[RS_NROOTS+1];
+
+  if(no_eras < 0 || no_eras > RS_NROOTS)
+    return -1;
+
+  // convert syndromes to index form
+  for(i=0;i<RS_NROOTS;i++)
+    s[i] = RS_INDEX_OF[s[i]];
+
+  memset(&lambda[1],0,RS_NROOTS*sizeof(lambda[0]));
+  lambda[0] = 1;
+
+  if(no_eras > 0){
+    // init lambda to be the erasure locator polynomial
+    for(i=0;i<no_eras;i++)
+      if(eras_pos[i] < 0 || eras_pos[i] >= len)
+        return -1;
+    lambda[1] = RS_ALPHA_TO[RS_FN(modnn)(RS_PRIM*(RS_NN-1-(eras_pos[0]+pad)))];
+    for(i=1;i<no_eras;i++){
+      u = RS_FN(modnn)(RS_PRIM*(RS_NN-1-(eras_pos[i]+pad)));
+      for(j=i+1;j>0;j--){
+        tmp = RS_INDEX_OF[lambda[j-1]];
+        if(tmp != RS_A0)
+          lambda[j] ^= RS_ALPHA_TO[RS_FN(modnn)(u + tmp)];
+      }
+    }
+  }
+  for(i=0;i<RS_NROOTS+1;i++)
+    b[i] = RS_INDEX_OF[lambda[i]];
+
+  // Berlekamp-Massey: r is the step number, el the degree of lambda(x)
+  r = no_eras;
+  el = no_eras;
+  while(++r <= RS_NROOTS){
+    // compute discrepancy at the r-th step in poly-form
+    discr_r = 0;
+    for(i=0;i<r;i++){
+      if((lambda[i] != 0) && (s[r-i-1] != RS_A0))
+        discr_r ^= RS_ALPHA_TO[RS_FN(modnn)(RS_INDEX_OF[lambda[i]] + s[r-i-1])];
+    }
+    discr_r = RS_INDEX_OF[discr_r];
+    if(discr_r == RS_A0){
+      // B(x) <-- x*B(x)
+      memmove(&b[1],b,RS_NROOTS*sizeof(b[0]));
+      b[0] = RS_A0;
+    } else {
+      // T(x) <-- lambda(x) - discr_r*x*b(x)
+      t[0] = lambda[0];
+      for(i=0;i<RS_NROOTS;i++){
+        if(b[i] != RS_A0)
+          t[i+1] = lambda[i+1] ^ RS_ALPHA_TO[RS_FN(modnn)(discr_r + b[i])];
+        else
+          t[i+1] = lambda[i+1];
+      }
+      if(2*el <= r + no_eras - 1){
+        el = r + no_eras - el;
+        // B(x) <-- inv(discr_r) * lambda(x)
+        for(i=0;i<=RS_NROOTS;i++)
+          b[i] = (lambda[i] == 0) ? RS_A0 : RS_FN(modnn)(RS_INDEX_OF[lambda[i]] - discr_r + RS_NN);
+      } else {
+        // B(x) <-- x*B(x)
+        memmove(&b[1],b,RS_NROOTS*sizeof(b[0]));
+        b[0] = RS_A0;
+      }
+      memcpy(lambda,t,(RS_NROOTS+1)*sizeof(t[0]));
+    }
+  }
+
+  // convert lambda to index form and compute deg(lambda(x))
+  deg_lambda = 0;
+  for(i=0;i<RS_NROOTS+1;i++){
+    lambda[i] = RS_INDEX_OF[lambda[i]];
+    if(lambda[i] != RS_A0)
+      deg_lambda = i;
+  }
+  if(deg_lambda == 0)
+    return -1; // syndromes but no error locations: too many errors
+
+  /* Chien search for the roots of lambda(x) over the positions sent,
+     stopping once all are found; reg[j] is lambda[j] times the j-th
+     power of the current trial root */
+  for(j=1;j<=deg_lambda;j++){
+    reg[j] = lambda[j] == RS_A0 ? RS_A0 : RS_FN(modnn)(lambda[j] + chien_start[j]);
+    step[j] = RS_FN(modnn)(j*RS_PRIM);
+  }
+  count = 0;
+  for(k=pad,i=root_start;k<RS_NN;k++,i=RS_FN(modnn)(i+RS_PRIM)){
+    q = 1; // lambda[0] is always 0
+    for(j=deg_lambda;j>0;j--){
+      if(reg[j] != RS_A0){
+        q ^= RS_ALPHA_TO[reg[j]];
+        reg[j] = RS_FN(modnn)(reg[j] + step[j]);
+      }
+    }
+    if(q != 0)
+      continue;
+    root[count] = i;
+    loc[count] = k;
+    if(++count == deg_lambda)
+      break;
+  }
+  if(deg_lambda != count)
+    return -1; // deg(lambda) unequal to number of roots sent: uncorrectable
+
+  // omega(x) = s(x)*lambda(x) (modulo x**RS_NROOTS), in index form
+  deg_omega = deg_lambda-1;
+  for(i=0;i<=deg_omega;i++){
+    tmp = 0;
+    for(j=i;j>=0;j--){
+      if((s[i - j] != RS_A0) && (lambda[j] != RS_A0))
+        tmp ^= RS_ALPHA_TO[RS_FN(modnn)(s[i - j] + lambda[j])];
+    }
+    omega[i] = RS_INDEX_OF[tmp];
+  }
+
+  /* Forney: compute error values in poly-form.
+     num1 = omega(inv(X(l))), num2 = inv(X(l))**(RS_FCR-1) and
+     den = lambda_pr(inv(X(l))) */
+  for(j=count-1;j>=0;j--){
+    num1 = 0;
+    for(i=deg_omega;i>=0;i--){
+      if(omega[i] != RS_A0)
+        num1 ^= RS_ALPHA_TO[RS_FN(modnn)(omega[i] + i * root[j])];
+    }
+    num2 = RS_ALPHA_TO[RS_FN(modnn)(root[j] * (RS_FCR - 1) + RS_NN)];
+    den = 0;
+    // lambda[i+1] for i even is the formal derivative lambda_pr of lambda[i]
+    for(i=(deg_lambda < RS_NROOTS-1 ? deg_lambda : RS_NROOTS-1) & ~1;i>=0;i-=2){
+      if(lambda[i+1] != RS_A0)
+        den ^= RS_ALPHA_TO[RS_FN(modnn)(lambda[i+1] + i * root[j])];
+    }
+    if(den == 0)
+      return -1;
+    val[j] = num1 == 0 ? 0 :
+      RS_ALPHA_TO[RS_FN(modnn)(RS_INDEX_OF[num1] + RS_INDEX_OF[num2] + RS_NN - RS_INDEX_OF[den])];
+  }
+  // apply the errors to data only once all of them are known
+  for(j=0;j<count;j++)
+    data[loc[j]-pad] ^= basis ? basis[val[j]] : val[j];
+  return count;
+}
+
+static inline int RS_FN(decode)(
+   unsigned char *data, // data_len data symbols then NROOTS parities, fixed in place
+   int data_len,
+   int root_start,      // from NAME_chien_init(data_len, chien_start)
+   const unsigned char *chien_start,
+   const int *eras_pos, // erased positions in data[], or NULL
+   int no_eras)
+{
+  unsigned char s[RS_NROOTS];
+
+  if(no_eras < 0 || no_eras > RS_NROOTS)
+    return -1;
+  // form the syndromes; i.e., evaluate data(x) at roots of g(x)
+  if(!RS_SYNDROMES(data,data_len+RS_NROOTS,s))
+    return 0; // the usual case: a clean codeword, nothing to correct
+  return RS_FN(decode_syn)(data, data_len, root_start, chien_start, eras_pos, no_eras, s, NULL);
+}
+
+static inline int RS_FN(decode_len)(unsigned char *data, int data_len,
+   const int *eras_pos, int no_eras)
+{
+  unsigned char chien_start[RS_NROOTS+1];
+  int root_start = RS_FN(chien_init)(data_len, chien_start);
+
+  if(root_start < 0)
+    return -1;
+  return RS_FN(decode)(data, data_len, root_start, chien_start, eras_pos, no_eras);
+}
+
+#undef RS_CAT2
+#undef RS_CAT
+#undef RS_FN
+#undef RS_T
+#undef RS_MM
+#undef RS_NN
+#undef RS_A0
+#undef RS_NROOTS
+#undef RS_FCR
+#undef RS_PRIM
+#undef RS_ALPHA_TO
+#undef RS_INDEX_OF
+#undef RS_GENPOLY
+#undef RS_SYNMUL
+#undef RS_SYNDROMES
+#undef RS_NAME
+#undef RS_TAB
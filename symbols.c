@@ -0,0 +1,320 @@
+/* symbols.c
+ * Bulk 10-bit symbol packing, see symbols.h
+ *
+ * The kernels work on whole words, three symbols each; pack_10b() and
+ * unpack_10b() do the partial words at either end.  The SIMD kernels
+ * take four words per 128 bits.  Unpacking picks the two bytes holding
+ * each symbol with a byte shuffle, then a multiply by 64, 16 or 4 and a
+ * shift right by 6 drops the bits either side of it.  Packing shuffles
+ * the second and third symbol of every word into one 32-bit lane and
+ * the first into another, and pmaddwd adds the third times 1024 to the
+ * second.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#include "make_wav.h"
+#include "symbols.h"
+
+// High-water marks kept by Put10bInBuffer(); pack_10b() moves them once
+// per call rather than once per symbol
+int maxNewBuffer, maxOldBuffer;
+
+static void pack_words_c(uint32_t *out, const uint16_t *in, long n)
+{
+	for (long i = 0; i < n; i++, in += CHARACTERS_PER_LONGWORD)
+		out[i] = (in[0] & CHARACTER_MASK) | (uint32_t)(in[1] & CHARACTER_MASK) << CHARACTER_BITS
+			| (uint32_t)(in[2] & CHARACTER_MASK) << (2 * CHARACTER_BITS);
+}
+
+static void unpack_words_c(uint16_t *out, const uint32_t *in, long n)
+{
+	for (long i = 0; i < n; i++, out += CHARACTERS_PER_LONGWORD) {
+		out[0] = in[i] & CHARACTER_MASK;
+		out[1] = (in[i] >> CHARACTER_BITS) & CHARACTER_MASK;
+		out[2] = (in[i] >> (2 * CHARACTER_BITS)) & CHARACTER_MASK;
+	}
+}
+
+#ifdef HAVE_X86
+#define X 0x80	// shuffle in a zero
+
+// Symbols 0..7 and 8..11 of four words, two bytes each, and the
+// multipliers that put the wanted ten bits at the top before >> 6
+static const char unpack_lo[16] = { 0,1, 1,2, 2,3, 4,5, 5,6, 6,7, 8,9, 9,10 };
+static const char unpack_hi[16] = { 10,11, 12,13, 13,14, 14,15, X,X, X,X, X,X, X,X };
+static const short unpack_mul_lo[8] = { 64, 16, 4, 64, 16, 4, 64, 16 };
+static const short unpack_mul_hi[8] = { 4, 64, 16, 4, 0, 0, 0, 0 };
+
+// Words 0, 1 come from symbols 0..7 (lo), words 2, 3 from 4..11 (hi):
+// (second, third) symbol of each word, and (first, 0)
+static const char pack_p_lo[16] = { 2,3,4,5, 8,9,10,11, X,X,X,X, X,X,X,X };
+static const char pack_p_hi[16] = { X,X,X,X, X,X,X,X, 6,7,8,9, 12,13,14,15 };
+static const char pack_q_lo[16] = { 0,1,X,X, 6,7,X,X, X,X,X,X, X,X,X,X };
+static const char pack_q_hi[16] = { X,X,X,X, X,X,X,X, 4,5,X,X, 10,11,X,X };
+#undef X
+
+__attribute__((target("ssse3")))
+static void pack_words_ssse3(uint32_t *out, const uint16_t *in, long n)
+{
+	const __m128i mask = _mm_set1_epi16(CHARACTER_MASK), mul = _mm_set1_epi32(1024 << 16 | 1);
+	const __m128i plo = _mm_loadu_si128((const __m128i *)pack_p_lo);
+	const __m128i phi = _mm_loadu_si128((const __m128i *)pack_p_hi);
+	const __m128i qlo = _mm_loadu_si128((const __m128i *)pack_q_lo);
+	const __m128i qhi = _mm_loadu_si128((const __m128i *)pack_q_hi);
+	long i;
+
+	for (i = 0; i + 4 <= n; i += 4, in += 12) {
+		__m128i lo = _mm_and_si128(_mm_loadu_si128((const __m128i *)in), mask);
+		__m128i hi = _mm_and_si128(_mm_loadu_si128((const __m128i *)(in + 4)), mask);
+		__m128i p = _mm_or_si128(_mm_shuffle_epi8(lo, plo), _mm_shuffle_epi8(hi, phi));
+		__m128i q = _mm_or_si128(_mm_shuffle_epi8(lo, qlo), _mm_shuffle_epi8(hi, qhi));
+		p = _mm_slli_epi32(_mm_madd_epi16(p, mul), CHARACTER_BITS);
+		_mm_storeu_si128((__m128i *)(out + i), _mm_or_si128(p, q));
+	}
+	pack_words_c(out + i, in, n - i);
+}
+
+__attribute__((target("ssse3")))
+static void unpack_words_ssse3(uint16_t *out, const uint32_t *in, long n)
+{
+	const __m128i slo = _mm_loadu_si128((const __m128i *)unpack_lo);
+	const __m128i shi = _mm_loadu_si128((const __m128i *)unpack_hi);
+	const __m128i mlo = _mm_loadu_si128((const __m128i *)unpack_mul_lo);
+	const __m128i mhi = _mm_loadu_si128((const __m128i *)unpack_mul_hi);
+	long i;
+
+	for (i = 0; i + 4 <= n; i += 4, out += 12) {
+		__m128i w = _mm_loadu_si128((const __m128i *)(in + i));
+		__m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_shuffle_epi8(w, slo), mlo), 6);
+		__m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_shuffle_epi8(w, shi), mhi), 6);
+		_mm_storeu_si128((__m128i *)out, lo);
+		_mm_storel_epi64((__m128i *)(out + 8), hi);
+	}
+	unpack_words_c(out, in + i, n - i);
+}
+
+// The same eight words at a time, four in each 128-bit lane
+__attribute__((target("avx2")))
+static void pack_words_avx2(uint32_t *out, const uint16_t *in, long n)
+{
+	const __m256i mask = _mm256_set1_epi16(CHARACTER_MASK), mul = _mm256_set1_epi32(1024 << 16 | 1);
+	const __m256i plo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)pack_p_lo));
+	const __m256i phi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)pack_p_hi));
+	const __m256i qlo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)pack_q_lo));
+	const __m256i qhi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)pack_q_hi));
+	long i;
+
+	for (i = 0; i + 8 <= n; i += 8, in += 24) {
+		__m256i lo = _mm256_and_si256(_mm256_loadu2_m128i((const __m128i *)(in + 12),
+			(const __m128i *)in), mask);
+		__m256i hi = _mm256_and_si256(_mm256_loadu2_m128i((const __m128i *)(in + 16),
+			(const __m128i *)(in + 4)), mask);
+		__m256i p = _mm256_or_si256(_mm256_shuffle_epi8(lo, plo), _mm256_shuffle_epi8(hi, phi));
+		__m256i q = _mm256_or_si256(_mm256_shuffle_epi8(lo, qlo), _mm256_shuffle_epi8(hi, qhi));
+		p = _mm256_slli_epi32(_mm256_madd_epi16(p, mul), CHARACTER_BITS);
+		_mm256_storeu_si256((__m256i *)(out + i), _mm256_or_si256(p, q));
+	}
+	_mm256_zeroupper();	// the rest is legacy SSE
+	pack_words_ssse3(out + i, in, n - i);
+}
+
+__attribute__((target("avx2")))
+static void unpack_words_avx2(uint16_t *out, const uint32_t *in, long n)
+{
+	const __m256i slo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)unpack_lo));
+	const __m256i shi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)unpack_hi));
+	const __m256i mlo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)unpack_mul_lo));
+	const __m256i mhi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)unpack_mul_hi));
+	long i;
+
+	for (i = 0; i + 8 <= n; i += 8, out += 24) {
+		__m256i w = _mm256_loadu_si256((const __m256i *)(in + i));
+		__m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_shuffle_epi8(w, slo), mlo), 6);
+		__m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_shuffle_epi8(w, shi), mhi), 6);
+		_mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(lo));
+		_mm_storel_epi64((__m128i *)(out + 8), _mm256_castsi256_si128(hi));
+		_mm_storeu_si128((__m128i *)(out + 12), _mm256_extracti128_si256(lo, 1));
+		_mm_storel_epi64((__m128i *)(out + 20), _mm256_extracti128_si256(hi, 1));
+	}
+	_mm256_zeroupper();
+	unpack_words_ssse3(out, in + i, n - i);
+}
+#endif
+
+static void (*pack_words)(uint32_t *, const uint16_t *, long);
+static void (*unpack_words)(uint16_t *, const uint32_t *, long);
+static int kernel_bits;
+
+int symbols_select(int bits)
+{
+	if (bits <= 0)
+		bits = 256;
+	pack_words = pack_words_c;
+	unpack_words = unpack_words_c;
+	kernel_bits = 32;
+#ifdef HAVE_X86
+	__builtin_cpu_init();
+	if (bits >= 256 && __builtin_cpu_supports("avx2")) {
+		pack_words = pack_words_avx2;
+		unpack_words = unpack_words_avx2;
+		kernel_bits = 256;
+	} else if (bits >= 128 && __builtin_cpu_supports("ssse3")) {
+		pack_words = pack_words_ssse3;
+		unpack_words = unpack_words_ssse3;
+		kernel_bits = 128;
+	}
+#endif
+	return kernel_bits;
+}
+
+void pack_10b(uint32_t *buffer, int index, const uint16_t *symbols, int count)
+{
+	int k = 0, last = index + count - 1;
+	long n;
+
+	if (count <= 0)
+		return;
+	if (pack_words == NULL)
+		symbols_select(0);
+	if (index % CHARACTERS_PER_LONGWORD) {		// finish the first word
+		uint32_t *w = buffer + index / CHARACTERS_PER_LONGWORD;
+		int p = index % CHARACTERS_PER_LONGWORD;
+		uint32_t acc = *w & ((1u << p * CHARACTER_BITS) - 1);
+		for (; k < count && p < CHARACTERS_PER_LONGWORD; k++, p++)
+			acc |= (uint32_t)(symbols[k] & CHARACTER_MASK) << (p * CHARACTER_BITS);
+		*w = acc;
+	}
+	n = (count - k) / CHARACTERS_PER_LONGWORD;
+	pack_words(buffer + (index + k) / CHARACTERS_PER_LONGWORD, symbols + k, n);
+	k += n * CHARACTERS_PER_LONGWORD;
+	if (k < count) {					// and start the last
+		uint32_t acc = 0;
+		for (int p = 0; k < count; k++, p++)
+			acc |= (uint32_t)(symbols[k] & CHARACTER_MASK) << (p * CHARACTER_BITS);
+		buffer[(index + k - 1) / CHARACTERS_PER_LONGWORD] = acc;
+	}
+
+	if (last / CHARACTERS_PER_LONGWORD > maxNewBuffer)
+		maxNewBuffer = last / CHARACTERS_PER_LONGWORD;
+	if (last > maxOldBuffer)
+		maxOldBuffer = last;
+}
+
+void unpack_10b(uint16_t *symbols, const uint32_t *buffer, int index, int count)
+{
+	int k = 0;
+	long n;
+
+	if (count <= 0)
+		return;
+	if (unpack_words == NULL)
+		symbols_select(0);
+	for (; k < count && (index + k) % CHARACTERS_PER_LONGWORD; k++)
+		symbols[k] = get10b_packed(buffer, index + k);
+	n = (count - k) / CHARACTERS_PER_LONGWORD;
+	unpack_words(symbols + k, buffer + (index + k) / CHARACTERS_PER_LONGWORD, n);
+	for (k += n * CHARACTERS_PER_LONGWORD; k < count; k++)
+		symbols[k] = get10b_packed(buffer, index + k);
+}
+
+long symbols_size(int layout, int count)
+{
+	if (layout == SYMBOLS_U16)
+		return count * (long)sizeof(uint16_t);
+	return LONGWORDS(count) * (long)sizeof(uint32_t);
+}
+
+int symbols_init(struct symbols *b, int layout, int count)
+{
+	b->layout = layout;
+	b->count = count;
+	b->data = calloc(1, symbols_size(layout, count));
+	return b->data ? 0 : -1;
+}
+
+void symbols_free(struct symbols *b)
+{
+	free(b->data);
+	b->data = NULL;
+	b->count = 0;
+}
+
+void symbols_put(struct symbols *b, int index, const uint16_t *symbols, int count)
+{
+	if (b->layout == SYMBOLS_U16)
+		memcpy((uint16_t *)b->data + index, symbols, count * sizeof(uint16_t));
+	else
+		pack_10b(b->data, index, symbols, count);
+}
+
+void symbols_get(const struct symbols *b, uint16_t *symbols, int index, int count)
+{
+	if (b->layout == SYMBOLS_U16)
+		memcpy(symbols, (const uint16_t *)b->data + index, count * sizeof(uint16_t));
+	else
+		unpack_10b(symbols, b->data, index, count);
+}
+
+void symbols_encode(struct symbols *b, int index, const unsigned char *data, int count,
+	int32_t *state)
+{
+	if (b->layout == SYMBOLS_U16)
+		encode_8b10b_words((uint16_t *)b->data + index, data, count, state);
+	else
+		encode_8b10b_packed(b->data, index, data, count, state);
+}
+
+// Load symbols below the unread bits while there is room for one more
+static void bit_reader_fill(struct bit_reader *r)
+{
+	while (r->nbits <= 64 - CHARACTER_BITS && r->next < r->count) {
+		int k = r->next++;
+		uint64_t sym = r->b->layout == SYMBOLS_U16 ? ((const uint16_t *)r->b->data)[k]
+			: get10b_packed(r->b->data, k);
+		r->bits |= (sym & CHARACTER_MASK) << (64 - CHARACTER_BITS - r->nbits);
+		r->nbits += CHARACTER_BITS;
+	}
+}
+
+void bit_reader_init(struct bit_reader *r, long sync, int sync_bits,
+	const struct symbols *b, int count)
+{
+	r->b = b;
+	r->next = 0;
+	r->count = b ? count : 0;
+	r->nbits = sync_bits;
+	r->bits = sync_bits ? (uint64_t)sync << (64 - sync_bits) : 0;
+	bit_reader_fill(r);
+}
+
+int bit_reader_run(struct bit_reader *r, int *bit)
+{
+	int n = 0;
+
+	if (r->nbits == 0)
+		return 0;
+	*bit = r->bits >> 63;
+	while (r->nbits > 0 && n < 64) {
+		// leading bits equal to the first, no further than those loaded
+		uint64_t same = *bit ? ~r->bits : r->bits;
+		int k = same ? __builtin_clzll(same) : 64;
+		if (k > r->nbits)
+			k = r->nbits;
+		if (k > 64 - n)
+			k = 64 - n;
+		n += k;
+		r->bits = k < 64 ? r->bits << k : 0;
+		r->nbits -= k;
+		bit_reader_fill(r);
+		if (r->nbits > 0 && (int)(r->bits >> 63) != *bit)
+			break;
+	}
+	return n;
+}
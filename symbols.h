@@ -0,0 +1,76 @@
+/* symbols.h
+ * Bulk conversion between arrays of 10-bit symbols and the packed layout
+ * of put10b_packed() in make_wav.h: three symbols to a 32-bit word, the
+ * first in the low bits, two bits left over at the top.
+ */
+
+#ifndef SYMBOLS_H
+#define SYMBOLS_H
+
+#include <stdint.h>
+
+void pack_10b(uint32_t *buffer, int index, const uint16_t *symbols, int count);
+    /* put10b_packed() for count symbols from index on: keeps the symbols
+       before index in its word and zeroes the bits after the last one.
+       Updates maxNewBuffer and maxOldBuffer once for the whole call */
+
+void unpack_10b(uint16_t *symbols, const uint32_t *buffer, int index, int count);
+    /* get10b_packed() for count symbols from index on */
+
+int symbols_select(int bits);
+    /* use the widest kernels of at most bits bits: 32 is plain C, 128
+       SSSE3 and 256 AVX2.  0, the default, is the widest the CPU has.
+       Returns the width now in use. */
+
+/*
+ * A buffer of 10-bit symbols in either layout: packed is 37% smaller,
+ * one to a uint16_t can be decoded in place.  bench_symbols measures
+ * both on the encode, synthesis and decode paths.
+ */
+#define SYMBOLS_PACKED	0	/* three to a uint32_t, as put10b_packed() */
+#define SYMBOLS_U16	1	/* one to a uint16_t */
+
+struct symbols {
+	int layout;
+	int count;		/* symbols there is room for */
+	void *data;		/* uint32_t[LONGWORDS(count)] or uint16_t[count] */
+};
+
+long symbols_size(int layout, int count);
+    /* bytes that count symbols take up in layout */
+
+int symbols_init(struct symbols *b, int layout, int count);
+    /* allocate a zeroed buffer for count symbols; returns 0, or -1 if
+       out of memory */
+
+void symbols_free(struct symbols *b);
+
+void symbols_put(struct symbols *b, int index, const uint16_t *symbols, int count);
+void symbols_get(const struct symbols *b, uint16_t *symbols, int index, int count);
+    /* pack_10b() and unpack_10b() for either layout */
+
+void symbols_encode(struct symbols *b, int index, const unsigned char *data, int count,
+	int32_t *state);
+    /* 8b10b encode count bytes into the buffer from index on, following
+       the running disparity in *state */
+
+/* Reads a frame as it is sent: the sync word, then each symbol, most
+   significant bit first, a run of identical bits at a time */
+struct bit_reader {
+	const struct symbols *b;
+	int next;		/* symbol to load next */
+	int count;		/* symbols in the frame */
+	int nbits;		/* bits loaded and not yet read */
+	uint64_t bits;		/* those bits, the next one at the top */
+};
+
+void bit_reader_init(struct bit_reader *r, long sync, int sync_bits,
+	const struct symbols *b, int count);
+    /* start at the sync_bits (0..64) bit sync word, followed by the
+       first count symbols of b */
+
+int bit_reader_run(struct bit_reader *r, int *bit);
+    /* read the run of identical bits at the front, at most 64 long;
+       stores the bit and returns how many, 0 at the end */
+
+#endif /* SYMBOLS_H */
@@ -0,0 +1,599 @@
+/* synth.c
+ * BPSK / DUV waveform synthesis back-end, moved out of make_wav.c so
+ * that one encoded symbol stream can be rendered at several sample rates.
+ *
+ * Each bit occupies rate/bit_rate samples.  When that is not an integer
+ * (44.1 kHz at 1200 bps) the bit clock carries the remainder forward, so
+ * bit lengths alternate between the two neighbouring integers and the
+ * average bit rate stays exact.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "make_wav.h"
+#include "synth.h"
+#include "checksum.h"
+
+// sin() over the first quadrant in Q15, 256 steps per quadrant
+static const short int sine_q15[257] = {
+	    0,  201,  402,  603,  804, 1005, 1206, 1407, 1608, 1809, 2009, 2210,
+	 2410, 2611, 2811, 3012, 3212, 3412, 3612, 3811, 4011, 4210, 4410, 4609,
+	 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195, 6393, 6590, 6786, 6983,
+	 7179, 7375, 7571, 7767, 7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319,
+	 9512, 9704, 9896,10087,10278,10469,10659,10849,11039,11228,11417,11605,
+	11793,11980,12167,12353,12539,12725,12910,13094,13279,13462,13645,13828,
+	14010,14191,14372,14553,14732,14912,15090,15269,15446,15623,15800,15976,
+	16151,16325,16499,16673,16846,17018,17189,17360,17530,17700,17869,18037,
+	18204,18371,18537,18703,18868,19032,19195,19357,19519,19680,19841,20000,
+	20159,20317,20475,20631,20787,20942,21096,21250,21403,21554,21705,21856,
+	22005,22154,22301,22448,22594,22739,22884,23027,23170,23311,23452,23592,
+	23731,23870,24007,24143,24279,24413,24547,24680,24811,24942,25072,25201,
+	25329,25456,25582,25708,25832,25955,26077,26198,26319,26438,26556,26674,
+	26790,26905,27019,27133,27245,27356,27466,27575,27683,27790,27896,28001,
+	28105,28208,28310,28411,28510,28609,28706,28803,28898,28992,29085,29177,
+	29268,29358,29447,29534,29621,29706,29791,29874,29956,30037,30117,30195,
+	30273,30349,30424,30498,30571,30643,30714,30783,30852,30919,30985,31050,
+	31113,31176,31237,31297,31356,31414,31470,31526,31580,31633,31685,31736,
+	31785,31833,31880,31926,31971,32014,32057,32098,32137,32176,32213,32250,
+	32285,32318,32351,32382,32412,32441,32469,32495,32521,32545,32567,32589,
+	32609,32628,32646,32663,32678,32692,32705,32717,32728,32737,32745,32752,
+	32757,32761,32765,32766,32767,
+};
+
+// Integer NCO: sine of the carrier phase nco_acc/rate in Q15
+static int nco_sine(long acc, int rate)
+{
+	int idx = (int)((acc * 1024) / rate);	// 0..1023 around the circle
+	int r = idx & 255;
+
+	switch (idx >> 8) {
+	case 0:	return sine_q15[r];
+	case 1:	return sine_q15[256 - r];
+	case 2:	return -sine_q15[r];
+	default: return -sine_q15[256 - r];
+	}
+}
+
+int synth_init(struct synth *s, int rate, int format, int bit_rate, int duv, long num_bits)
+{
+	s->rate = rate;
+	s->bit_rate = bit_rate;
+	s->duv = duv;
+	s->format = format;
+	s->amplitude = SYNTH_AMPLITUDE;
+	s->freq_Hz = SYNTH_FREQ_HZ;
+	s->smaller = rate / (2 * s->freq_Hz);
+	s->verbose = 0;
+	s->nco = 0;
+
+	s->phase = 1;
+	s->ctr = 0;
+	s->flip_ctr = 0;
+	s->bit_frac = 0;
+	s->bits = 0;
+	s->nco_acc = 0;
+	s->sync_cache = NULL;
+	s->sync_cache_failed = 0;
+	s->frame_cache = NULL;
+	s->frame_hits = s->frame_misses = s->frame_evictions = 0;
+
+	s->buf_len = (num_bits * rate + bit_rate - 1) / bit_rate;
+	s->buffer = calloc(s->buf_len, sizeof(short int));
+	return s->buffer ? 0 : -1;
+}
+
+static void sync_cache_free(struct sync_cache *c);
+
+void synth_free(struct synth *s)
+{
+	free(s->buffer);
+	s->buffer = NULL;
+	sync_cache_free(s->sync_cache);
+	s->sync_cache = NULL;
+	synth_frame_cache(s, 0);
+}
+
+static void write_wave(struct synth *s)
+{
+	if (s->nco)
+	{
+		int amp = SYNTH_AMPLITUDE;
+		if (s->duv)
+			s->buffer[s->ctr++] = amp / 4 * s->phase;
+		else
+		{
+			if ((s->ctr - s->flip_ctr) < s->smaller)
+				amp = amp * 2 / 5;
+			s->buffer[s->ctr++] = amp * s->phase * nco_sine(s->nco_acc, s->rate) / 32768;
+		}
+	}
+	else
+		if (s->duv)
+		{
+//			if ((ctr - flip_ctr) < smaller)
+//				buffer[ctr++] = 0.1 * phase * (ctr - flip_ctr) / smaller;
+//			else
+				s->buffer[s->ctr++] = 0.25 * s->amplitude * s->phase;
+		}
+		else
+		{
+			if ((s->ctr - s->flip_ctr) < s->smaller)
+  		 		s->buffer[s->ctr++] = (int)(s->amplitude * 0.4 * s->phase *
+  		 								sin((float)(2*M_PI*s->nco_acc/s->rate)));
+ 			else
+ 		 		s->buffer[s->ctr++] = (int)(s->amplitude * s->phase *
+ 		 								sin((float)(2*M_PI*s->nco_acc/s->rate)));
+ 		 }
+	s->nco_acc += (long)s->freq_Hz;
+	if (s->nco_acc >= s->rate)
+		s->nco_acc -= s->rate;
+}
+
+// Write the samples of nbits bits at the current phase
+static void write_bits(struct synth *s, int nbits)
+{
+	long n;
+
+	s->bit_frac += (long)nbits * s->rate;
+	n = s->bit_frac / s->bit_rate;
+	s->bit_frac -= n * s->bit_rate;
+	if (s->ctr + n > s->buf_len)
+		n = s->buf_len - s->ctr;
+	while (n-- > 0)
+		write_wave(s);
+	s->bits += nbits;
+}
+
+// Send one bit: write its samples with the current phase, then apply
+// the phase change the bit calls for to the bits that follow.
+static void synth_bit(struct synth *s, int data)
+{
+	write_bits(s, 1);
+
+	if (s->duv)
+	{
+		s->phase = ((data != 0) * 2) - 1;
+		if (s->verbose)
+			printf("Sending a %d\n", s->phase);
+	}
+	else
+	{
+		if (data == 0)  {
+			s->phase *= -1;
+			if ( (s->ctr - s->smaller) > 0)
+			{
+				for (int j = 1; j <= s->smaller; j++)
+					if (s->nco)
+						s->buffer[s->ctr - j] = s->buffer[s->ctr - j] * 2 / 5;
+					else
+						s->buffer[s->ctr - j] = s->buffer[s->ctr - j] * 0.4;
+			}
+			s->flip_ctr = s->ctr;
+		}
+	}
+}
+
+// Send n bits of the same value.  Within a run the phase only changes
+// after a BPSK 0, so a run of 1s, or all but the first bit of a DUV run,
+// is one stretch of samples at one phase and the bit clock can be
+// advanced for the whole run at once.
+static void synth_run(struct synth *s, int data, int n)
+{
+	if (!s->duv && data == 0)
+	{
+		while (n-- > 0)
+			synth_bit(s, 0);
+		return;
+	}
+	if (s->duv)
+	{
+		synth_bit(s, data);
+		n--;
+	}
+	write_bits(s, n);
+}
+
+// Send everything left in the reader, a run at a time
+static void synth_reader(struct synth *s, struct bit_reader *r)
+{
+	int data, n;
+
+	while ((n = bit_reader_run(r, &data)) > 0)
+		synth_run(s, data, n);
+}
+
+static void trace_bits(struct synth *s, long word, int nbits)
+{
+	for (int bit = nbits; bit > 0; bit--)
+		printf ("%ld new frame sync bit %d = %d \n",
+			s->bits + nbits - bit, bit, (word & 1L << (bit - 1)) != 0);
+}
+
+void synth_bits(struct synth *s, long word, int nbits)
+{
+	if (!s->verbose)
+	{
+		struct bit_reader r;
+		bit_reader_init(&r, word, nbits, NULL, 0);
+		synth_reader(s, &r);
+		return;
+	}
+	trace_bits(s, word, nbits);
+	for (int bit = nbits; bit > 0; bit--)
+		synth_bit(s, (word & 1L << (bit - 1)) != 0);
+}
+
+/*
+ * Sync word cache
+ *
+ * The sync word is the same in every frame, so its samples only depend on
+ * the modulator state it starts from: carrier phase (nco_acc), BPSK phase,
+ * how far into the attenuation after a phase flip we are, and the bit clock
+ * remainder.  Each state seen gets the sync rendered once; later frames
+ * starting from that state memcpy it.  Entries are made on first use and
+ * kept in a small hash table keyed by the state: at common rates only a
+ * few dozen states ever occur, and at rates that share no factor with the
+ * bit rate or carrier (44101 Hz) there are far too many to hold, so past
+ * SYNC_MAX_ENTRIES the sync word is rendered without caching.
+ */
+#define SYNC_SLOTS 256		// power of 2
+#define SYNC_MAX_ENTRIES 4096
+
+struct sync_entry {
+	struct sync_entry *next;	// hash chain
+	long key;		// starting state, see sync_key()
+	int n;			// samples
+	int phase;		// BPSK phase after the sync word
+	int flip_off;		// last phase flip relative to start, -1 if none
+	short int samples[];
+};
+
+struct sync_cache {
+	long word;
+	int nbits;
+	long entries;
+	struct sync_entry *slot[SYNC_SLOTS];
+};
+
+// A phase flip attenuates the samples before it.  If that could reach
+// back past the start of a sync word or frame, its samples depend on more
+// than the state it starts from and cannot be cached.
+static int self_contained(struct synth *s)
+{
+	return s->smaller < s->rate / s->bit_rate;
+}
+
+// Samples still to be sent attenuated after the last phase flip
+static int atten_left(struct synth *s)
+{
+	int atten = s->smaller - (s->ctr - s->flip_ctr);
+
+	return (atten < 0 || s->duv) ? 0 : atten;
+}
+
+static void sync_cache_free(struct sync_cache *c)
+{
+	if (c == NULL)
+		return;
+	for (int k = 0; k < SYNC_SLOTS; k++)
+		while (c->slot[k])
+		{
+			struct sync_entry *e = c->slot[k];
+			c->slot[k] = e->next;
+			free(e);
+		}
+	free(c);
+}
+
+// The state the sync word starts from, as one number
+static long sync_key(struct synth *s)
+{
+	long key = s->duv ? 0 : s->nco_acc;	// no carrier in DUV
+
+	key = key * s->bit_rate + s->bit_frac;
+	key = key * 2 + (s->phase > 0);
+	return key * (s->smaller + 1) + atten_left(s);
+}
+
+static struct sync_entry **sync_slot(struct sync_cache *c, long key)
+{
+	return &c->slot[((uint64_t)key * 0x9e3779b97f4a7c15ULL) >> 56 & (SYNC_SLOTS - 1)];
+}
+
+void synth_sync(struct synth *s, long word, int nbits)
+{
+	struct sync_cache *c = s->sync_cache;
+	struct sync_entry *e;
+	long start = s->ctr, key;
+
+	if (!self_contained(s))
+	{
+		synth_bits(s, word, nbits);
+		return;
+	}
+	if (c == NULL || c->word != word || c->nbits != nbits)
+	{
+		sync_cache_free(c);
+		s->sync_cache = NULL;
+		c = s->sync_cache_failed ? NULL : calloc(1, sizeof(*c));
+		if (c == NULL)
+		{
+			s->sync_cache_failed = 1;	// don't try again every frame
+			synth_bits(s, word, nbits);
+			return;
+		}
+		c->word = word;
+		c->nbits = nbits;
+		s->sync_cache = c;
+	}
+
+	key = sync_key(s);
+	for (e = *sync_slot(c, key); e && e->key != key; e = e->next)
+		;
+	if (e == NULL || s->ctr + e->n > s->buf_len)
+	{
+		long max_n = ((long)nbits * s->rate + s->bit_rate - 1) / s->bit_rate + 1;
+
+		synth_bits(s, word, nbits);
+		if (e == NULL && c->entries < SYNC_MAX_ENTRIES && start + max_n <= s->buf_len
+			&& (e = malloc(sizeof(*e) + (s->ctr - start) * sizeof(short int))) != NULL)
+		{
+			e->key = key;
+			e->n = s->ctr - start;
+			e->phase = s->phase;
+			e->flip_off = s->flip_ctr >= start ? s->flip_ctr - start : -1;
+			memcpy(e->samples, s->buffer + start, e->n * sizeof(short int));
+			e->next = *sync_slot(c, key);
+			*sync_slot(c, key) = e;
+			c->entries++;
+		}
+		return;
+	}
+
+	if (s->verbose)
+		trace_bits(s, word, nbits);
+	memcpy(s->buffer + s->ctr, e->samples, e->n * sizeof(short int));
+	s->ctr += e->n;
+	s->phase = e->phase;
+	if (e->flip_off >= 0)
+		s->flip_ctr = start + e->flip_off;
+	s->bit_frac = (s->bit_frac + (long)nbits * s->rate) % s->bit_rate;
+	s->nco_acc = (s->nco_acc + e->n * (long)s->freq_Hz) % s->rate;
+	s->bits += nbits;
+}
+
+/*
+ * Frame cache
+ *
+ * Frames repeat (beacons, test corpora), so whole rendered frames are kept
+ * in a hash table keyed by XXH64 of the sync word, symbols and starting
+ * modulator state, with an LRU list to stay under a memory limit.  A hit
+ * compares the stored symbols and state before copying, so a hash
+ * collision can only cost a miss.
+ */
+#define FRAME_BUCKETS 4096	// power of 2
+
+struct frame_entry {
+	uint64_t hash;
+	struct frame_entry *hnext;	// hash chain
+	struct frame_entry *prev, *next; // LRU list, most recent first
+	long bytes;
+
+	// key
+	long sync, nco_acc, bit_frac;
+	int sync_bits, count, phase, atten;
+	int layout;			// of the symbols
+	void *data10;
+
+	// result
+	int n;
+	int end_phase;
+	int flip_off;			// last phase flip relative to start, -1 if none
+	short int samples[];
+};
+
+struct frame_cache {
+	long max_bytes, bytes;
+	struct frame_entry *head, *tail;
+	struct frame_entry *bucket[FRAME_BUCKETS];
+};
+
+static void frame_unlink(struct frame_cache *c, struct frame_entry *e)
+{
+	if (e->prev) e->prev->next = e->next; else c->head = e->next;
+	if (e->next) e->next->prev = e->prev; else c->tail = e->prev;
+}
+
+static void frame_push(struct frame_cache *c, struct frame_entry *e)
+{
+	e->prev = NULL;
+	e->next = c->head;
+	if (c->head) c->head->prev = e; else c->tail = e;
+	c->head = e;
+}
+
+static void frame_evict(struct synth *s, struct frame_entry *e)
+{
+	struct frame_cache *c = s->frame_cache;
+	struct frame_entry **pp = &c->bucket[e->hash & (FRAME_BUCKETS - 1)];
+
+	while (*pp != e)
+		pp = &(*pp)->hnext;
+	*pp = e->hnext;
+	frame_unlink(c, e);
+	c->bytes -= e->bytes;
+	free(e);
+	s->frame_evictions++;
+}
+
+int synth_frame_cache(struct synth *s, long max_bytes)
+{
+	struct frame_cache *c = s->frame_cache;
+
+	if (c)
+	{
+		while (c->head)
+			frame_evict(s, c->head);
+		free(c);
+		s->frame_cache = NULL;
+	}
+	if (max_bytes <= 0)
+		return 0;
+	c = calloc(1, sizeof(*c));
+	if (c == NULL)
+		return -1;
+	c->max_bytes = max_bytes;
+	s->frame_cache = c;
+	return 0;
+}
+
+long synth_frame_cache_bytes(struct synth *s)
+{
+	return s->frame_cache ? s->frame_cache->bytes : 0;
+}
+
+static uint64_t frame_hash(struct synth *s, long sync, int sync_bits,
+	const struct symbols *data10, int count)
+{
+	struct xxh64_state st;
+	long state[7] = { sync, sync_bits, s->nco_acc, s->bit_frac, s->phase, atten_left(s),
+		data10->layout };
+
+	xxh64_reset(&st, 0);
+	xxh64_update(&st, state, sizeof(state));
+	xxh64_update(&st, data10->data, symbols_size(data10->layout, count));
+	return xxh64_digest(&st);
+}
+
+static int frame_match(struct synth *s, struct frame_entry *e, long sync, int sync_bits,
+	const struct symbols *data10, int count)
+{
+	return e->sync == sync && e->sync_bits == sync_bits && e->count == count
+		&& e->nco_acc == s->nco_acc && e->bit_frac == s->bit_frac
+		&& e->phase == s->phase && e->atten == atten_left(s) && e->layout == data10->layout
+		&& memcmp(e->data10, data10->data, symbols_size(data10->layout, count)) == 0;
+}
+
+void synth_frame(struct synth *s, long sync, int sync_bits, const struct symbols *data10, int count)
+{
+	struct frame_cache *c = s->frame_cache;
+	struct frame_entry *e, new_key;
+	uint64_t hash;
+	long start = s->ctr, bytes;
+
+	if (c == NULL || s->verbose || !self_contained(s))
+	{
+		synth_sync(s, sync, sync_bits);
+		synth_symbols(s, data10, count);
+		return;
+	}
+
+	hash = frame_hash(s, sync, sync_bits, data10, count);
+	for (e = c->bucket[hash & (FRAME_BUCKETS - 1)]; e; e = e->hnext)
+		if (e->hash == hash && frame_match(s, e, sync, sync_bits, data10, count))
+			break;
+
+	if (e && s->ctr + e->n <= s->buf_len)
+	{
+		s->frame_hits++;
+		frame_unlink(c, e);
+		frame_push(c, e);
+		memcpy(s->buffer + s->ctr, e->samples, e->n * sizeof(short int));
+		s->ctr += e->n;
+		s->phase = e->end_phase;
+		if (e->flip_off >= 0)
+			s->flip_ctr = start + e->flip_off;
+		s->bit_frac = (s->bit_frac + (long)(sync_bits + 10 * count) * s->rate) % s->bit_rate;
+		s->nco_acc = (s->nco_acc + e->n * (long)s->freq_Hz) % s->rate;
+		s->bits += sync_bits + 10 * count;
+		return;
+	}
+
+	s->frame_misses++;
+	new_key.sync = sync;
+	new_key.sync_bits = sync_bits;
+	new_key.count = count;
+	new_key.nco_acc = s->nco_acc;
+	new_key.bit_frac = s->bit_frac;
+	new_key.phase = s->phase;
+	new_key.atten = atten_left(s);
+	new_key.layout = data10->layout;
+
+	synth_sync(s, sync, sync_bits);
+	synth_symbols(s, data10, count);
+	if (e != NULL || s->ctr >= s->buf_len)
+		return;		// already cached, or clipped at the end of the buffer
+
+	bytes = sizeof(*e) + (s->ctr - start + 1) / 2 * 2 * sizeof(short int)
+		+ symbols_size(data10->layout, count);
+	if (bytes > c->max_bytes)
+		return;
+	while (c->bytes + bytes > c->max_bytes)
+		frame_evict(s, c->tail);
+	e = malloc(bytes);
+	if (e == NULL)
+		return;
+	*e = new_key;
+	e->hash = hash;
+	e->bytes = bytes;
+	e->n = s->ctr - start;
+	e->end_phase = s->phase;
+	e->flip_off = s->flip_ctr >= start ? s->flip_ctr - start : -1;
+	memcpy(e->samples, s->buffer + start, e->n * sizeof(short int));
+	e->data10 = e->samples + (e->n + 1) / 2 * 2;
+	memcpy(e->data10, data10->data, symbols_size(data10->layout, count));
+	e->hnext = c->bucket[hash & (FRAME_BUCKETS - 1)];
+	c->bucket[hash & (FRAME_BUCKETS - 1)] = e;
+	frame_push(c, e);
+	c->bytes += bytes;
+}
+
+// Send one 10-bit symbol, most significant bit first
+static void synth_symbol(struct synth *s, int symbol, int val)
+{
+	for (int bit = 10; bit > 0; bit--)
+	{
+		int data = val & 1 << (bit - 1);
+		if (s->verbose)
+			printf ("%ld data10[%d] = %x bit %d = %d \n",
+				s->bits, symbol, val, bit, (data > 0) );
+		synth_bit(s, data);
+	}
+}
+
+void synth_symbols(struct synth *s, const struct symbols *data10, int count)
+{
+	if (!s->verbose)
+	{
+		struct bit_reader r;
+		bit_reader_init(&r, 0, 0, data10, count);
+		synth_reader(s, &r);
+		return;
+	}
+	if (data10->layout == SYMBOLS_U16)
+	{
+		const uint16_t *p = data10->data;
+		for (int symbol = 0; symbol < count; symbol++)
+			synth_symbol(s, symbol, p[symbol] & CHARACTER_MASK);
+		return;
+	}
+	const uint32_t *p = data10->data;
+	for (int symbol = 0; symbol < count; p++)
+	{
+		uint32_t word = *p;	// first symbol in the low bits
+		for (int k = 0; k < CHARACTERS_PER_LONGWORD && symbol < count; k++, symbol++)
+		{
+			synth_symbol(s, symbol, word & CHARACTER_MASK);
+			word >>= CHARACTER_BITS;
+		}
+	}
+}
+
+void synth_write(struct synth *s, char *filename)
+{
+	write_wav_format(filename, s->buf_len, s->buffer, s->rate, s->format);
+}
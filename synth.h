@@ -0,0 +1,80 @@
+/* synth.h
+ * BPSK / DUV waveform synthesis back-end.
+ *
+ * One struct synth holds everything the modulator used to keep in
+ * globals (sample buffer, sample counter, BPSK phase, last phase flip),
+ * so several back-ends at different sample rates and output formats can
+ * render the same encoded symbol stream side by side.
+ */
+
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <stdint.h>
+
+#include "symbols.h"
+
+#define SYNTH_FREQ_HZ 3000		// BPSK carrier; 1200
+#define SYNTH_AMPLITUDE (32767/3)	// 20000; // 32767/(10%amp+5%amp+100%amp)
+
+struct synth {
+	int rate;		// samples per second
+	int bit_rate;		// 1200 for BPSK, 200 for DUV
+	int duv;		// 1 for DUV (no carrier), 0 for BPSK
+	int format;		// WAV_S16, WAV_U8 or WAV_F32
+	float amplitude;
+	float freq_Hz;
+	int smaller;		// samples attenuated either side of a phase flip
+	int verbose;		// print a trace line for every bit sent
+	int nco;		// 1: integer NCO and integer arithmetic only, so the
+				// output is bit-identical on every host
+
+	int phase;		// +1 or -1
+	long ctr;		// next sample to write
+	long flip_ctr;		// sample at which the phase last flipped
+	long bit_frac;		// bit clock remainder, 0 <= bit_frac < bit_rate
+	long bits;		// bits rendered so far
+	long nco_acc;		// carrier phase, (ctr * freq) mod rate
+
+	short int *buffer;
+	long buf_len;
+
+	struct sync_cache *sync_cache;	// rendered sync words, see synth_sync()
+	int sync_cache_failed;		// out of memory for it, render uncached
+	struct frame_cache *frame_cache; // rendered frames, see synth_frame()
+	long frame_hits, frame_misses, frame_evictions;
+};
+
+int synth_init(struct synth *s, int rate, int format, int bit_rate, int duv, long num_bits);
+    /* allocate a zeroed buffer big enough for num_bits at rate;
+       returns 0 on success, -1 if the buffer could not be allocated */
+
+void synth_bits(struct synth *s, long word, int nbits);
+    /* send the low nbits of word, most significant bit first */
+
+void synth_sync(struct synth *s, long word, int nbits);
+    /* same as synth_bits() for the frame sync word, but splices in a copy
+       rendered earlier from the same modulator state when there is one */
+
+void synth_symbols(struct synth *s, const struct symbols *data10, int count);
+    /* send the first count 10-bit symbols, each most significant bit
+       first */
+
+int synth_frame_cache(struct synth *s, long max_bytes);
+    /* keep up to max_bytes of rendered frames for synth_frame() to reuse,
+       least recently used first out; 0 turns the cache off.
+       returns 0 on success, -1 if out of memory */
+
+long synth_frame_cache_bytes(struct synth *s);
+    /* memory currently held by the frame cache */
+
+void synth_frame(struct synth *s, long sync, int sync_bits, const struct symbols *data10, int count);
+    /* send a whole frame: the sync word then count 10-bit symbols.  When the same symbols were rendered before from the same
+       modulator state the cached samples are copied instead */
+
+void synth_write(struct synth *s, char *filename);
+    /* write the whole buffer as a WAV file in the back-end's format */
+
+void synth_free(struct synth *s);
+
+#endif /* SYNTH_H */
@@ -0,0 +1,261 @@
+/* wav.c
+ * WAV file output, split out of make_wav.c so that every synthesis
+ * back-end can share it.
+ * Output is monophonic, signed 16-bit, unsigned 8-bit or 32-bit float samples
+ * copyright
+ * Fri Jun 18 16:36:23 PDT 2010 Kevin Karplus
+ * Creative Commons license Attribution-NonCommercial
+ *  http://creativecommons.org/licenses/by-nc/3.0/
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "make_wav.h"
+
+#define WAV_CHUNK 4096 /* samples converted per fwrite() */
+
+void write_little_endian(unsigned int word, int num_bytes, FILE *wav_file)
+{
+	unsigned buf;
+	while(num_bytes>0)
+	{   buf = word & 0xff;
+		fwrite(&buf, 1,1, wav_file);
+		num_bytes--;
+	word >>= 8;
+	}
+}
+
+int wav_bytes_per_sample(int format)
+{
+	switch (format) {
+	case WAV_U8:	return 1;
+	case WAV_F32:	return 4;
+	default:	return 2;
+	}
+}
+
+/* Store one sample in little endian order in the requested format */
+static unsigned char *put_sample(unsigned char *p, short int sample, int format)
+{
+	union { float f; uint32_t u; } v;
+
+	switch (format) {
+	case WAV_U8:
+		*p++ = (unsigned char)((sample >> 8) + 128);
+		break;
+	case WAV_F32:
+		v.f = sample / 32768.0f;
+		*p++ = v.u & 0xff;
+		*p++ = (v.u >> 8) & 0xff;
+		*p++ = (v.u >> 16) & 0xff;
+		*p++ = (v.u >> 24) & 0xff;
+		break;
+	default:
+		*p++ = sample & 0xff;
+		*p++ = (sample >> 8) & 0xff;
+		break;
+	}
+	return p;
+}
+
+/* information about the WAV file format from
+
+http://ccrma.stanford.edu/courses/422/projects/WaveFormat/
+
+ */
+
+static void write_header(FILE *wav_file, unsigned long num_samples, unsigned int sample_rate, int format)
+{
+	unsigned int num_channels;
+	unsigned int bytes_per_sample;
+	unsigned int byte_rate;
+
+	num_channels = 1;   /* monoaural */
+	bytes_per_sample = wav_bytes_per_sample(format);
+	byte_rate = sample_rate*num_channels*bytes_per_sample;
+
+	/* write RIFF header */
+	fwrite("RIFF", 1, 4, wav_file);
+	write_little_endian(36 + bytes_per_sample* num_samples*num_channels, 4, wav_file);
+	fwrite("WAVE", 1, 4, wav_file);
+
+	/* write fmt  subchunk */
+	fwrite("fmt ", 1, 4, wav_file);
+	write_little_endian(16, 4, wav_file);   /* SubChunk1Size is 16 */
+	write_little_endian(format == WAV_F32 ? 3 : 1, 2, wav_file); /* PCM is format 1, IEEE float 3 */
+	write_little_endian(num_channels, 2, wav_file);
+	write_little_endian(sample_rate, 4, wav_file);
+	write_little_endian(byte_rate, 4, wav_file);
+	write_little_endian(num_channels*bytes_per_sample, 2, wav_file);  /* block align */
+	write_little_endian(8*bytes_per_sample, 2, wav_file);  /* bits/sample */
+
+	/* write data subchunk */
+	fwrite("data", 1, 4, wav_file);
+	write_little_endian(bytes_per_sample* num_samples*num_channels, 4, wav_file);
+}
+
+int wav_writer_open(struct wav_writer *w, char *filename, int s_rate, int format)
+{
+	w->file = fopen(filename, "w");
+	if (w->file == NULL)
+		return -1;
+	w->format = format;
+	w->rate = s_rate<=0 ? 44100 : s_rate;
+	w->samples = 0;
+	write_header(w->file, 0, w->rate, format);	/* sizes patched by wav_writer_close() */
+	return 0;
+}
+
+void wav_writer_write(struct wav_writer *w, const short int *data, unsigned long num_samples)
+{
+	unsigned long i, n;    /* counters for samples */
+	unsigned char chunk[WAV_CHUNK * 4], *p;
+
+	for (i = 0; i < num_samples; i += n)
+	{
+		n = num_samples - i;
+		if (n > WAV_CHUNK)
+			n = WAV_CHUNK;
+		p = chunk;
+		for (unsigned long j = 0; j < n; j++)
+			p = put_sample(p, data[i + j], w->format);
+		fwrite(chunk, 1, p - chunk, w->file);
+	}
+	w->samples += num_samples;
+}
+
+int wav_writer_close(struct wav_writer *w)
+{
+	int err = 0;
+
+	if (fseek(w->file, 0, SEEK_SET) == 0)
+		write_header(w->file, w->samples, w->rate, w->format);
+	else
+		err = -1;
+	if (fclose(w->file) != 0)
+		err = -1;
+	w->file = NULL;
+	return err;
+}
+
+void write_wav_format(char * filename, unsigned long num_samples, short int * data, int s_rate, int format)
+{
+	struct wav_writer w;
+	int opened = wav_writer_open(&w, filename, s_rate, format);
+
+	assert(opened == 0);   /* make sure it opened */
+	wav_writer_write(&w, data, num_samples);
+	wav_writer_close(&w);
+}
+
+static unsigned long read_little_endian(const unsigned char *p, int num_bytes)
+{
+	unsigned long word = 0;
+
+	while (num_bytes-- > 0)
+		word = (word << 8) | p[num_bytes];
+	return word;
+}
+
+int wav_reader_open(struct wav_reader *r, char *filename)
+{
+	unsigned char hdr[16];
+	unsigned long size;
+	int have_fmt = 0;
+
+	r->file = fopen(filename, "r");
+	if (r->file == NULL)
+		return -1;
+	if (fread(hdr, 1, 12, r->file) != 12 || memcmp(hdr, "RIFF", 4) != 0 || memcmp(hdr + 8, "WAVE", 4) != 0)
+		goto bad;
+
+	/* walk the subchunks up to "data", skipping any we do not need */
+	for (;;) {
+		if (fread(hdr, 1, 8, r->file) != 8)
+			goto bad;
+		size = read_little_endian(hdr + 4, 4);
+		if (memcmp(hdr, "fmt ", 4) == 0 && size >= 16) {
+			int tag, bits;
+			if (fread(hdr, 1, 16, r->file) != 16)
+				goto bad;
+			tag = read_little_endian(hdr, 2);
+			r->channels = read_little_endian(hdr + 2, 2);
+			r->rate = read_little_endian(hdr + 4, 4);
+			bits = read_little_endian(hdr + 14, 2);
+			if (tag == 1 && bits == 16) r->format = WAV_S16;
+			else if (tag == 1 && bits == 8) r->format = WAV_U8;
+			else if (tag == 3 && bits == 32) r->format = WAV_F32;
+			else goto bad;
+			if (r->channels != 1)
+				goto bad;
+			have_fmt = 1;
+			size -= 16;
+		} else if (memcmp(hdr, "data", 4) == 0) {
+			if (!have_fmt)
+				goto bad;
+			r->samples = r->remaining = size / wav_bytes_per_sample(r->format);
+			return 0;
+		}
+		if (fseek(r->file, size + (size & 1), SEEK_CUR) != 0)	/* chunks are word aligned */
+			goto bad;
+	}
+bad:
+	fclose(r->file);
+	r->file = NULL;
+	return -1;
+}
+
+long wav_reader_read(struct wav_reader *r, short int *data, long num_samples)
+{
+	unsigned char chunk[WAV_CHUNK * 4];
+	int bps = wav_bytes_per_sample(r->format);
+	long done = 0;
+
+	if (num_samples > r->remaining)
+		num_samples = r->remaining;
+	while (done < num_samples) {
+		long n = num_samples - done, got;
+		if (n > WAV_CHUNK)
+			n = WAV_CHUNK;
+		got = fread(chunk, bps, n, r->file);
+		for (long i = 0; i < got; i++) {
+			const unsigned char *p = chunk + i * bps;
+			union { float f; uint32_t u; } v;
+			switch (r->format) {
+			case WAV_U8:
+				data[done + i] = (p[0] - 128) * 256;
+				break;
+			case WAV_F32:
+				v.u = read_little_endian(p, 4);
+				v.f *= 32768.0f;
+				if (!(v.f == v.f))	// NaN fails both clamps below
+					v.f = 0;
+				data[done + i] = v.f >= 32767.0f ? 32767 : v.f <= -32768.0f ? -32768 : (short int)v.f;
+				break;
+			default:
+				data[done + i] = (short int)read_little_endian(p, 2);
+				break;
+			}
+		}
+		done += got;
+		if (got < n)
+			break;
+	}
+	r->remaining -= done;
+	return done;
+}
+
+void wav_reader_close(struct wav_reader *r)
+{
+	if (r->file)
+		fclose(r->file);
+	r->file = NULL;
+}
+
+void write_wav(char * filename, unsigned long num_samples, short int * data, int s_rate)
+{
+	write_wav_format(filename, num_samples, data, s_rate, WAV_S16);
+}